@@ -27,8 +27,25 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * @abstract A private category that reports the transitions of a navigation controller to the tab bar controller it is nested in.
+ * @discussion Only attached navigation controllers are affected: their class is replaced with a subclass that overrides
+ * the push and pop methods, while the rest of the navigation controllers in the process keep their own implementations.
+ */
 @interface UINavigationController (Extensions)
 
+/**
+ * @abstract Starts reporting the transitions and the navigation bar height to the given tab bar controller.
+ * @param tabBarController The tab bar controller to report to.
+ */
+- (void)tb_attachToTabBarController:(TBTabBarController *)tabBarController;
+
+/**
+ * @abstract Stops reporting and restores the original class of the navigation controller, if possible.
+ * @discussion Called automatically when the navigation controller is removed from its parent.
+ */
+- (void)tb_detachFromTabBarController;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -27,15 +27,21 @@
 #import "TBTabBarController.h"
 #import "TBTabBarController+Private.h"
 #import "_TBUtils.h"
+#import "_TBInteractiveTransitionTracker.h"
 
 #import <objc/runtime.h>
 
+static NSString *const _TBNavigationControllerSubclassPrefix = @"_TBTabBarControllerNested_";
+
 @interface UINavigationController ()
 
 @property (weak, nonatomic, setter = tb_setPrivateDelegate:) id<TBNavigationControllerExtensionDelegate> tb_delegate;
 
 @property (assign, nonatomic, getter = tb_isNestedInTBTabBarController, setter = tb_setNestedInTBTabBarController:) BOOL tb_nestedInTBTabBarController;
 @property (assign, nonatomic, getter = tb_isInteractivePopGestureRecognizerRegistered, setter = tb_setInteractivePopGestureRecognizerRegistered:) BOOL tb_interactivePopGestureRecognizerRegistered;
+@property (strong, nonatomic, nullable, setter = tb_setNavigationBarHeight:) NSNumber *tb_navigationBarHeight;
+@property (assign, nonatomic, nullable, setter = tb_setOriginalClass:) Class tb_originalClass;
+@property (strong, nonatomic, readonly) _TBInteractiveTransitionTracker *tb_interactiveTransitionTracker;
 
 @end
 
@@ -44,50 +50,98 @@
 static char *tb_nestedInTBTabBarControllerKey;
 static char *tb_interactivePopGestureRecognizerRegisteredKey;
 static char *tb_privateDelegateKey;
+static char *tb_navigationBarHeightKey;
+static char *tb_originalClassKey;
+static char *tb_interactiveTransitionTrackerKey;
+
+#pragma mark Public Methods
+
+- (void)tb_attachToTabBarController:(TBTabBarController *)tabBarController {
+
+    if (self.tb_delegate == (id<TBNavigationControllerExtensionDelegate>)tabBarController) {
+        return;
+    }
+
+    // Our subclass may be kept below another one (e.g. a KVO one) after a detach, in which case the stored original class
+    // is still valid. Subclassing on top would make the other subclass the original one, and the overrides would call themselves.
+    if ([self tb_isInstanceSubclassed] == false) {
+        Class const originalClass = object_getClass(self);
+        Class const subclass = _TBInstanceSubclass(originalClass, _TBNavigationControllerSubclassPrefix, ^(Class subclass) {
+            [UINavigationController tb_addOverridesToSubclass:subclass];
+        });
+        if (subclass == nil) {
+            return;
+        }
+        self.tb_originalClass = originalClass;
+        object_setClass(self, subclass);
+    }
+
+    self.tb_delegate = (id<TBNavigationControllerExtensionDelegate>)tabBarController;
+    self.tb_nestedInTBTabBarController = true;
+    self.tb_navigationBarHeight = nil;
 
-#pragma mark Lifecycle
+    if (!self.tb_isInteractivePopGestureRecognizerRegistered && self.interactivePopGestureRecognizer != nil) {
+        [self tb_registerInteractivePopGestureRecognizer:self.interactivePopGestureRecognizer];
+    }
 
-+ (void)load {
+    [self tb_update];
+}
 
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        _TBSwizzleMethod([self class],
-                         @selector(popViewControllerAnimated:),
-                         @selector(tb_popViewControllerAnimated:));
+- (void)tb_detachFromTabBarController {
 
-        _TBSwizzleMethod([self class],
-                         @selector(popToViewController:animated:),
-                         @selector(tb_popToViewController:animated:));
+    if (!self.tb_isNestedInTBTabBarController) {
+        return;
+    }
 
-        _TBSwizzleMethod([self class],
-                         @selector(popToRootViewControllerAnimated:),
-                         @selector(tb_popToRootViewControllerAnimated:));
+    if (self.tb_isInteractivePopGestureRecognizerRegistered) {
+        [self.interactivePopGestureRecognizer removeTarget:self action:@selector(tb_handleInteractivePopGestureRecognizer:)];
+        [objc_getAssociatedObject(self, &tb_interactiveTransitionTrackerKey) stop];
+        self.tb_interactivePopGestureRecognizerRegistered = false;
+    }
 
-        _TBSwizzleMethod([self class],
-                         @selector(pushViewController:animated:),
-                         @selector(tb_pushViewController:animated:));
+    self.tb_nestedInTBTabBarController = false;
+    self.tb_delegate = nil;
+    self.tb_navigationBarHeight = nil;
 
-        _TBSwizzleMethod([self class],
-                         @selector(didMoveToParentViewController:),
-                         @selector(tb_didMoveToParentViewController:));
+    Class const originalClass = self.tb_originalClass;
 
-        _TBSwizzleMethod([self class],
-                         @selector(viewDidLayoutSubviews),
-                         @selector(tb_viewDidLayoutSubviews));
-    });
+    // Another subclass (e.g. a KVO one) may have been put on top of ours, so the instance keeps it in this case.
+    // The overrides check whether the navigation controller is still nested, so they stay cheap pass-throughs.
+    if (originalClass != nil && [NSStringFromClass(object_getClass(self)) hasPrefix:_TBNavigationControllerSubclassPrefix]) {
+        object_setClass(self, originalClass);
+        self.tb_originalClass = nil;
+    }
 }
 
 #pragma mark Overrides
 
++ (void)tb_addOverridesToSubclass:(Class)subclass {
+
+    SEL const selectors[][2] = {
+        {@selector(popViewControllerAnimated:), @selector(tb_popViewControllerAnimated:)},
+        {@selector(popToViewController:animated:), @selector(tb_popToViewController:animated:)},
+        {@selector(popToRootViewControllerAnimated:), @selector(tb_popToRootViewControllerAnimated:)},
+        {@selector(pushViewController:animated:), @selector(tb_pushViewController:animated:)},
+        {@selector(didMoveToParentViewController:), @selector(tb_didMoveToParentViewController:)},
+        {@selector(viewDidLayoutSubviews), @selector(tb_viewDidLayoutSubviews)}
+    };
+
+    for (NSUInteger index = 0; index < sizeof(selectors) / sizeof(selectors[0]); index += 1) {
+        Method const method = class_getInstanceMethod(self, selectors[index][1]);
+        class_addMethod(subclass, selectors[index][0], method_getImplementation(method), method_getTypeEncoding(method));
+    }
+}
+
 - (UIViewController *)tb_popViewControllerAnimated:(BOOL)animated {
 
-    UIViewController *previousViewController = [self tb_popViewControllerAnimated:animated];
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(popViewControllerAnimated:)];
+    UIViewController *previousViewController = ((UIViewController *(*)(id, SEL, BOOL))implementation)(self, @selector(popViewControllerAnimated:), animated);
 
     if (!self.tb_isNestedInTBTabBarController) {
         return previousViewController;
     }
 
-    [previousViewController setValue:nil forKey:NSStringFromSelector(@selector(tb_tabBarController))];
+    [TBTabBarController _invalidateCachedTabBarControllers];
 
     [self tb_popViewController:previousViewController
      destinationViewController:self.topViewController
@@ -101,15 +155,14 @@ static char *tb_privateDelegateKey;
 
     UIViewController *previousViewController = self.topViewController;
 
-    NSArray<__kindof UIViewController *> *viewControllers = [self tb_popToViewController:viewController animated:animated];
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(popToViewController:animated:)];
+    NSArray<__kindof UIViewController *> *viewControllers = ((NSArray *(*)(id, SEL, UIViewController *, BOOL))implementation)(self, @selector(popToViewController:animated:), viewController, animated);
 
     if (!self.tb_isNestedInTBTabBarController) {
         return viewControllers;
     }
 
-    for (UIViewController *viewController in viewControllers) {
-        [viewController setValue:nil forKey:NSStringFromSelector(@selector(tb_tabBarController))];
-    }
+    [TBTabBarController _invalidateCachedTabBarControllers];
 
     [self tb_popViewController:previousViewController destinationViewController:viewController animated:animated];
 
@@ -120,12 +173,15 @@ static char *tb_privateDelegateKey;
 
     UIViewController *previousViewController = self.topViewController;
 
-    NSArray<__kindof UIViewController *> *viewControllers = [self tb_popToRootViewControllerAnimated:animated];
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(popToRootViewControllerAnimated:)];
+    NSArray<__kindof UIViewController *> *viewControllers = ((NSArray *(*)(id, SEL, BOOL))implementation)(self, @selector(popToRootViewControllerAnimated:), animated);
 
-    for (UIViewController *viewController in viewControllers) {
-        [viewController setValue:nil forKey:NSStringFromSelector(@selector(tb_tabBarController))];
+    if (!self.tb_isNestedInTBTabBarController) {
+        return viewControllers;
     }
 
+    [TBTabBarController _invalidateCachedTabBarControllers];
+
     [self tb_popViewController:previousViewController destinationViewController:self.topViewController animated:animated];
 
     return viewControllers;
@@ -133,16 +189,18 @@ static char *tb_privateDelegateKey;
 
 - (void)tb_pushViewController:(UIViewController *)viewController animated:(BOOL)animated {
 
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(pushViewController:animated:)];
+
     if (!self.tb_isNestedInTBTabBarController) {
-        [self tb_pushViewController:viewController animated:animated];
+        ((void (*)(id, SEL, UIViewController *, BOOL))implementation)(self, @selector(pushViewController:animated:), viewController, animated);
         return;
     }
 
     UIViewController *prevViewController = self.topViewController; // Get the top view controller before it will be replaced with a new view controller
 
-    [viewController setValue:prevViewController.tb_tabBarController forKey:NSStringFromSelector(@selector(tb_tabBarController))];
+    ((void (*)(id, SEL, UIViewController *, BOOL))implementation)(self, @selector(pushViewController:animated:), viewController, animated);
 
-    [self tb_pushViewController:viewController animated:animated];
+    [TBTabBarController _invalidateCachedTabBarControllers];
 
     if (self.tb_isInteractivePopGestureRecognizerRegistered == false && self.interactivePopGestureRecognizer != nil) {
         [self tb_registerInteractivePopGestureRecognizer:self.interactivePopGestureRecognizer];
@@ -208,25 +266,21 @@ static char *tb_privateDelegateKey;
 
 - (void)tb_viewDidLayoutSubviews {
 
-    [self tb_viewDidLayoutSubviews];
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(viewDidLayoutSubviews)];
+    ((void (*)(id, SEL))implementation)(self, @selector(viewDidLayoutSubviews));
 
-    if (self.tb_nestedInTBTabBarController) {
+    if (self.tb_isNestedInTBTabBarController) {
         [self tb_update];
     }
 }
 
 - (void)tb_didMoveToParentViewController:(UIViewController *)parent {
 
-    [self tb_didMoveToParentViewController:parent];
+    IMP const implementation = [self tb_originalImplementationForSelector:@selector(didMoveToParentViewController:)];
+    ((void (*)(id, SEL, UIViewController *))implementation)(self, @selector(didMoveToParentViewController:), parent);
 
-    if (parent == nil && self.tb_isNestedInTBTabBarController) {
-        [self.interactivePopGestureRecognizer removeTarget:self action:@selector(tb_handleInteractivePopGestureRecognizer:)];
-        self.tb_nestedInTBTabBarController = false;
-        self.tb_delegate = nil;
-    } else if ([parent isKindOfClass:[TBTabBarController class]]) {
-        self.tb_delegate = (id<TBNavigationControllerExtensionDelegate>)parent;
-        self.tb_nestedInTBTabBarController = true;
-        [self tb_update];
+    if (parent == nil) {
+        [self tb_detachFromTabBarController];
     }
 }
 
@@ -243,8 +297,16 @@ static char *tb_privateDelegateKey;
 
 - (void)tb_handleInteractivePopGestureRecognizer:(UIPanGestureRecognizer *)interactivePopGestureRecognizer {
 
-    if (interactivePopGestureRecognizer.state == UIGestureRecognizerStateEnded) {
-        return;
+    switch (interactivePopGestureRecognizer.state) {
+        case UIGestureRecognizerStateEnded:
+        case UIGestureRecognizerStateCancelled:
+        case UIGestureRecognizerStateFailed:
+            // The transition coordinator takes it from here
+            [self.tb_interactiveTransitionTracker stop];
+            return;
+
+        default:
+            break;
     }
 
     CGFloat const translation = [interactivePopGestureRecognizer translationInView:self.view].x;
@@ -255,10 +317,8 @@ static char *tb_privateDelegateKey;
 
     CGFloat const completed = MAX(0.0, MIN(1.0, translation / CGRectGetWidth(self.view.bounds)));
 
-    [self.tb_delegate tb_navigationController:self
-                     didUpdateInteractiveFrom:[self.transitionCoordinator viewControllerForKey:UITransitionContextFromViewControllerKey]
-                                           to:self.topViewController
-                              percentComplete:completed];
+    // Touches may come several times per frame, so the delegate is informed once per display refresh
+    [self.tb_interactiveTransitionTracker updatePercentComplete:completed];
 }
 
 #pragma mark Helpers
@@ -376,8 +436,34 @@ static char *tb_privateDelegateKey;
         }
     }
 
-    [self.tb_delegate tb_navigationController:self
-                 navigationBarDidChangeHeight:value + self.view.safeAreaInsets.top];
+    CGFloat const height = value + self.view.safeAreaInsets.top;
+    NSNumber *reportedHeight = self.tb_navigationBarHeight;
+
+    if (reportedHeight != nil && reportedHeight.doubleValue == height) {
+        return;
+    }
+
+    self.tb_navigationBarHeight = @(height);
+
+    [self.tb_delegate tb_navigationController:self navigationBarDidChangeHeight:height];
+}
+
+- (BOOL)tb_isInstanceSubclassed {
+
+    for (Class class = object_getClass(self); class != nil; class = class_getSuperclass(class)) {
+        if ([NSStringFromClass(class) hasPrefix:_TBNavigationControllerSubclassPrefix]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+- (IMP)tb_originalImplementationForSelector:(SEL)selector {
+
+    Class const originalClass = self.tb_originalClass;
+
+    return class_getMethodImplementation(originalClass != nil ? originalClass : [UINavigationController class], selector);
 }
 
 #pragma mark Getters
@@ -397,6 +483,38 @@ static char *tb_privateDelegateKey;
     return objc_getAssociatedObject(self, &tb_privateDelegateKey);
 }
 
+- (_TBInteractiveTransitionTracker *)tb_interactiveTransitionTracker {
+
+    _TBInteractiveTransitionTracker *tracker = objc_getAssociatedObject(self, &tb_interactiveTransitionTrackerKey);
+
+    if (tracker == nil) {
+        __weak typeof(self) weakSelf = self;
+        tracker = [[_TBInteractiveTransitionTracker alloc] initWithHandler:^(CGFloat percentComplete) {
+            if (weakSelf == nil) {
+                return;
+            }
+            typeof(self) strongSelf = weakSelf;
+            [strongSelf.tb_delegate tb_navigationController:strongSelf
+                                   didUpdateInteractiveFrom:[strongSelf.transitionCoordinator viewControllerForKey:UITransitionContextFromViewControllerKey]
+                                                         to:strongSelf.topViewController
+                                            percentComplete:percentComplete];
+        }];
+        objc_setAssociatedObject(self, &tb_interactiveTransitionTrackerKey, tracker, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+
+    return tracker;
+}
+
+- (NSNumber *)tb_navigationBarHeight {
+
+    return objc_getAssociatedObject(self, &tb_navigationBarHeightKey);
+}
+
+- (Class)tb_originalClass {
+
+    return objc_getAssociatedObject(self, &tb_originalClassKey);
+}
+
 #pragma mark Setters
 
 - (void)tb_setNestedInTBTabBarController:(BOOL)tb_nestedInTBTabBarController {
@@ -415,6 +533,22 @@ static char *tb_privateDelegateKey;
                              OBJC_ASSOCIATION_RETAIN_NONATOMIC);
 }
 
+- (void)tb_setNavigationBarHeight:(NSNumber *)tb_navigationBarHeight {
+
+    objc_setAssociatedObject(self,
+                             &tb_navigationBarHeightKey,
+                             tb_navigationBarHeight,
+                             OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+- (void)tb_setOriginalClass:(Class)tb_originalClass {
+
+    objc_setAssociatedObject(self,
+                             &tb_originalClassKey,
+                             tb_originalClass,
+                             OBJC_ASSOCIATION_ASSIGN);
+}
+
 - (void)tb_setPrivateDelegate:(id<TBNavigationControllerExtensionDelegate>)tb_privateDelegate {
 
     objc_setAssociatedObject(self,
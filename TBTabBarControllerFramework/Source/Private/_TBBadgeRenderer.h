@@ -0,0 +1,64 @@
+//
+//  _TBBadgeRenderer.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private class that renders tab badges such as "3" or "99+".
+ * @discussion Badge values change often, so the renderer never lays out text for a value it has seen before.
+ * Every character is rasterized once per font, scale and text color and kept as a glyph bitmap. A badge is composed
+ * from these bitmaps on a pill-shaped background, and the composed badge is cached by its value and style, so setting
+ * the same value again returns the same image.
+ */
+@interface _TBBadgeRenderer : NSObject
+
+/**
+ * @abstract Returns the shared renderer.
+ */
++ (instancetype)sharedRenderer;
+
+/**
+ * @abstract Returns a badge image for the given value.
+ * @param value The badge value to render.
+ * @param font The font of the text.
+ * @param textColor The color of the text. Dynamic colors should be resolved beforehand.
+ * @param backgroundColor The color of the background. Dynamic colors should be resolved beforehand.
+ * @param scale The scale to render the badge at.
+ * @return A badge image.
+ */
+- (UIImage *)badgeImageForValue:(NSString *)value
+                           font:(UIFont *)font
+                      textColor:(UIColor *)textColor
+                backgroundColor:(UIColor *)backgroundColor
+                          scale:(CGFloat)scale;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
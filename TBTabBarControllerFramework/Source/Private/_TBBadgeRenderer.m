@@ -0,0 +1,175 @@
+//
+//  _TBBadgeRenderer.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBBadgeRenderer.h"
+#import "_TBUtils.h"
+
+static CGFloat const _TBBadgeRendererHorizontalPadding = 4.0;
+static CGFloat const _TBBadgeRendererVerticalPadding = 1.0;
+static NSUInteger const _TBBadgeRendererBadgesCountLimit = 256;
+
+static NSString *_TBBadgeRendererColorKey(UIColor *color) {
+
+    CGFloat red, green, blue, alpha;
+
+    if ([color getRed:&red green:&green blue:&blue alpha:&alpha]) {
+        return [NSString stringWithFormat:@"%.4f,%.4f,%.4f,%.4f", red, green, blue, alpha];
+    }
+
+    return color.description;
+}
+
+@implementation _TBBadgeRenderer {
+
+    NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, UIImage *> *> *_glyphs; // Glyph style -> (character -> bitmap)
+    NSCache<NSString *, UIImage *> *_badges; // Badge style and value -> bitmap
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedRenderer {
+
+    static _TBBadgeRenderer *sharedRenderer;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        sharedRenderer = [[_TBBadgeRenderer alloc] _init];
+    });
+
+    return sharedRenderer;
+}
+
+- (instancetype)_init {
+
+    self = [super init];
+
+    if (self) {
+        _glyphs = [NSMutableDictionary dictionary];
+        _badges = [[NSCache alloc] init];
+        _badges.countLimit = _TBBadgeRendererBadgesCountLimit;
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+
+    return self;
+}
+
+#pragma mark Public Methods
+
+- (UIImage *)badgeImageForValue:(NSString *)value font:(UIFont *)font textColor:(UIColor *)textColor backgroundColor:(UIColor *)backgroundColor scale:(CGFloat)scale {
+
+    NSString *glyphStyleKey = [NSString stringWithFormat:@"%@|%.2f|%.2f|%@", font.fontName, font.pointSize, scale, _TBBadgeRendererColorKey(textColor)];
+    NSString *badgeKey = [NSString stringWithFormat:@"%@|%@|%@", glyphStyleKey, _TBBadgeRendererColorKey(backgroundColor), value];
+
+    UIImage *badge = [_badges objectForKey:badgeKey];
+
+    if (badge != nil) {
+        return badge;
+    }
+
+    NSMutableDictionary<NSString *, UIImage *> *glyphs = _glyphs[glyphStyleKey];
+
+    if (glyphs == nil) {
+        glyphs = [NSMutableDictionary dictionary];
+        _glyphs[glyphStyleKey] = glyphs;
+    }
+
+    // Glyphs
+
+    NSMutableArray<UIImage *> *glyphImages = [NSMutableArray arrayWithCapacity:value.length];
+
+    __block CGFloat textWidth = 0.0;
+    __block CGFloat textHeight = 0.0;
+
+    [value enumerateSubstringsInRange:NSMakeRange(0, value.length) options:NSStringEnumerationByComposedCharacterSequences usingBlock:^(NSString *character, NSRange substringRange, NSRange enclosingRange, BOOL *stop) {
+        UIImage *glyphImage = glyphs[character];
+        if (glyphImage == nil) {
+            glyphImage = [self _rasterizeCharacter:character font:font textColor:textColor scale:scale];
+            glyphs[character] = glyphImage;
+        }
+        [glyphImages addObject:glyphImage];
+        textWidth += glyphImage.size.width;
+        textHeight = MAX(textHeight, glyphImage.size.height);
+    }];
+
+    // Composition
+
+    CGFloat const height = _TBPixelAccurateValue(MAX(textHeight, font.lineHeight) + (_TBBadgeRendererVerticalPadding * 2.0), scale, true);
+    CGFloat const width = _TBPixelAccurateValue(MAX(height, textWidth + (_TBBadgeRendererHorizontalPadding * 2.0)), scale, true);
+    CGSize const size = (CGSize){width, height};
+
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = scale;
+    format.opaque = false;
+
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:size format:format];
+
+    badge = [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        [backgroundColor setFill];
+        [[UIBezierPath bezierPathWithRoundedRect:(CGRect){CGPointZero, size} cornerRadius:height / 2.0] fill];
+        CGFloat x = _TBPixelAccurateValue((width - textWidth) / 2.0, scale, false);
+        for (UIImage *glyphImage in glyphImages) {
+            CGSize const glyphSize = glyphImage.size;
+            [glyphImage drawAtPoint:(CGPoint){x, _TBPixelAccurateValue((height - glyphSize.height) / 2.0, scale, false)}];
+            x += glyphSize.width;
+        }
+    }];
+
+    [_badges setObject:badge forKey:badgeKey];
+
+    return badge;
+}
+
+#pragma mark Private Methods
+
+#pragma mark Rendering
+
+- (UIImage *)_rasterizeCharacter:(NSString *)character font:(UIFont *)font textColor:(UIColor *)textColor scale:(CGFloat)scale {
+
+    NSDictionary<NSAttributedStringKey, id> *attributes = @{
+        NSFontAttributeName: font,
+        NSForegroundColorAttributeName: textColor
+    };
+
+    CGSize const size = _TBPixelAccurateSize([character sizeWithAttributes:attributes], scale, true);
+
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = scale;
+    format.opaque = false;
+
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:size format:format];
+
+    return [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        [character drawAtPoint:CGPointZero withAttributes:attributes];
+    }];
+}
+
+#pragma mark Notifications
+
+- (void)_didReceiveMemoryWarning:(NSNotification *)notification {
+
+    [_glyphs removeAllObjects];
+    [_badges removeAllObjects];
+}
+
+@end
@@ -0,0 +1,64 @@
+//
+//  _TBImageStore.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private class that makes images with identical content share a single instance.
+ * @discussion Items often get separate but identical images, e.g. decoded from the same data or drawn by the same code,
+ * and every button of both tab bars used to hold on to them. The store addresses bitmaps by their content: the first image
+ * with a given content is kept (weakly) and returned for every later image with the same pixels and the same drawing attributes,
+ * so items, their copies and the buttons of both bars share one bitmap. Images that come from an asset catalog,
+ * symbol images, images with accessibility information and images without a bitmap are returned as is.
+ * Reading the pixels may decode the whole bitmap, so it happens on a background queue: an image is returned as is the first time,
+ * and the caller is given the stored image once it is found. Only a sample of the pixels is hashed, the pixels of images
+ * with the same hash are compared in full. Safe to use from any thread.
+ */
+@interface _TBImageStore : NSObject
+
+/**
+ * @abstract Returns the shared store.
+ */
++ (instancetype)sharedStore;
+
+/**
+ * @abstract Returns the image to use instead of the given one, as far as the store knows it yet.
+ * @discussion The content of an image is read once, in the background. Until then, the given image is returned,
+ * and the replacement handler is called on the main thread if a stored image with the same content is found.
+ * Later calls with the same instance return the result right away.
+ * @param image The image.
+ * @param replacementHandler The block to call with the stored image with the same content, if there is one.
+ * @return The image to use instead of the given one.
+ */
+- (nullable UIImage *)imageForImage:(nullable UIImage *)image replacementHandler:(void (^)(UIImage *storedImage))replacementHandler;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,244 @@
+//
+//  _TBImageStore.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBImageStore.h"
+
+#import <os/lock.h>
+
+static uint64_t const _TBImageStoreHashSeed = 0xcbf29ce484222325ULL;
+
+static NSUInteger const _TBImageStoreSampledWordsCount = 256;
+
+static NSUInteger const _TBImageStorePurgeCountMinimum = 32;
+
+/// Continues the 64-bit FNV-1a hash with the bytes
+static uint64_t _TBImageStoreHashBytes(uint64_t hash, const void *data, NSUInteger length) {
+
+    const uint8_t *bytes = data;
+
+    for (NSUInteger index = 0; index < length; index += 1) {
+        hash ^= bytes[index];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/// Continues the hash with evenly spaced words of the pixels rather than every byte of them.
+/// Collisions only cost a comparison of the pixels, which `memcmp` does far faster than the hash would go through them
+static uint64_t _TBImageStoreHashPixels(uint64_t hash, NSData *pixels) {
+
+    NSUInteger const wordsCount = pixels.length / sizeof(uint64_t);
+    NSUInteger const stride = MAX(wordsCount / _TBImageStoreSampledWordsCount, (NSUInteger)1);
+
+    const uint8_t *bytes = pixels.bytes;
+
+    for (NSUInteger index = 0; index < wordsCount; index += stride) {
+        uint64_t word;
+        memcpy(&word, bytes + index * sizeof(uint64_t), sizeof(word));
+        hash = _TBImageStoreHashBytes(hash, &word, sizeof(word));
+    }
+
+    return _TBImageStoreHashBytes(hash, &wordsCount, sizeof(wordsCount));
+}
+
+/// Returns whether two images are drawn the same way, given that their pixels are the same
+static BOOL _TBImageStoreAttributesMatch(UIImage *image, UIImage *otherImage) {
+
+    CGImageRef const cgImage = image.CGImage;
+    CGImageRef const otherCGImage = otherImage.CGImage;
+
+    CGColorSpaceRef const colorSpace = CGImageGetColorSpace(cgImage);
+    CGColorSpaceRef const otherColorSpace = CGImageGetColorSpace(otherCGImage);
+
+    return image.scale == otherImage.scale &&
+        image.imageOrientation == otherImage.imageOrientation &&
+        image.renderingMode == otherImage.renderingMode &&
+        image.resizingMode == otherImage.resizingMode &&
+        image.flipsForRightToLeftLayoutDirection == otherImage.flipsForRightToLeftLayoutDirection &&
+        UIEdgeInsetsEqualToEdgeInsets(image.capInsets, otherImage.capInsets) &&
+        UIEdgeInsetsEqualToEdgeInsets(image.alignmentRectInsets, otherImage.alignmentRectInsets) &&
+        CGImageGetWidth(cgImage) == CGImageGetWidth(otherCGImage) &&
+        CGImageGetHeight(cgImage) == CGImageGetHeight(otherCGImage) &&
+        CGImageGetBitsPerComponent(cgImage) == CGImageGetBitsPerComponent(otherCGImage) &&
+        CGImageGetBitsPerPixel(cgImage) == CGImageGetBitsPerPixel(otherCGImage) &&
+        CGImageGetBytesPerRow(cgImage) == CGImageGetBytesPerRow(otherCGImage) &&
+        CGImageGetBitmapInfo(cgImage) == CGImageGetBitmapInfo(otherCGImage) &&
+        (colorSpace == otherColorSpace || (colorSpace != NULL && otherColorSpace != NULL && CFEqual(colorSpace, otherColorSpace)));
+}
+
+@implementation _TBImageStore {
+
+    NSMapTable<UIImage *, UIImage *> *_resolvedImages; // Image -> the image to use instead, so the content of an instance is read once
+    NSMapTable<NSNumber *, UIImage *> *_storedImages; // Content hash -> the first image with that content, touched on the queue only
+    NSUInteger _storedImagesPurgeCount; // The number of stored entries that triggers a purge of the entries whose images went away
+    dispatch_queue_t _queue;
+    os_unfair_lock _lock;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedStore {
+
+    static _TBImageStore *sharedStore;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        sharedStore = [[_TBImageStore alloc] _init];
+    });
+
+    return sharedStore;
+}
+
+- (instancetype)_init {
+
+    self = [super init];
+
+    if (self) {
+        _resolvedImages = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+                                                valueOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality];
+        // Nothing is kept alive by the store, an image goes away once no item or button holds it
+        _storedImages = [NSMapTable strongToWeakObjectsMapTable];
+        _storedImagesPurgeCount = _TBImageStorePurgeCountMinimum;
+        _queue = dispatch_queue_create("com.tbtabbarcontroller.imagestore", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+
+    return self;
+}
+
+#pragma mark Public Methods
+
+- (UIImage *)imageForImage:(UIImage *)image replacementHandler:(void (^)(UIImage *storedImage))replacementHandler {
+
+    if (image == nil || image.CGImage == NULL || image.images != nil || image.imageAsset != nil) {
+        // Images of an asset catalog may have variants for other traits and are cached by UIKit anyway
+        return image;
+    }
+
+    if (image.accessibilityLabel != nil || image.accessibilityIdentifier != nil) {
+        // What is attached to the instance would be lost if another instance were returned
+        return image;
+    }
+
+    if (@available(iOS 13.0, *)) {
+        if (image.isSymbolImage) {
+            return image;
+        }
+    }
+
+    os_unfair_lock_lock(&_lock);
+    UIImage *resolvedImage = [_resolvedImages objectForKey:image];
+    os_unfair_lock_unlock(&_lock);
+
+    if (resolvedImage != nil) {
+        return resolvedImage;
+    }
+
+    // Reading the pixels may decode the whole bitmap, so the caller keeps the image until the store is done with it
+
+    dispatch_async(_queue, ^{
+        UIImage *storedImage = [self _resolveImage:image];
+        if (storedImage != image) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                replacementHandler(storedImage);
+            });
+        }
+    });
+
+    return image;
+}
+
+#pragma mark Private Methods
+
+- (UIImage *)_resolveImage:(UIImage *)image {
+
+    os_unfair_lock_lock(&_lock);
+    UIImage *resolvedImage = [_resolvedImages objectForKey:image];
+    os_unfair_lock_unlock(&_lock);
+
+    if (resolvedImage != nil) {
+        // The same instance was set several times before the first request was handled
+        return resolvedImage;
+    }
+
+    NSData *pixels = CFBridgingRelease(CGDataProviderCopyData(CGImageGetDataProvider(image.CGImage)));
+
+    if (pixels == nil) {
+        return image;
+    }
+
+    // The attributes that most often differ between images with the same pixels (e.g. a template and an original variant) are hashed as well
+
+    struct {
+        CGFloat scale;
+        NSInteger orientation;
+        NSInteger renderingMode;
+        size_t width;
+    } const attributes = {image.scale, image.imageOrientation, image.renderingMode, CGImageGetWidth(image.CGImage)};
+
+    uint64_t hash = _TBImageStoreHashPixels(_TBImageStoreHashSeed, pixels);
+    hash = _TBImageStoreHashBytes(hash, &attributes, sizeof(attributes));
+
+    NSNumber *key = @(hash);
+    UIImage *storedImage = [_storedImages objectForKey:key];
+
+    resolvedImage = image;
+
+    if (storedImage == nil) {
+        [_storedImages setObject:image forKey:key];
+        [self _purgeStoredImagesIfNeeded];
+    } else if (storedImage != image && _TBImageStoreAttributesMatch(storedImage, image)) {
+        // The hash only narrows the search down, the pixels are compared to be sure
+        NSData *storedPixels = CFBridgingRelease(CGDataProviderCopyData(CGImageGetDataProvider(storedImage.CGImage)));
+        if ([storedPixels isEqualToData:pixels]) {
+            resolvedImage = storedImage;
+        }
+    }
+
+    os_unfair_lock_lock(&_lock);
+    [_resolvedImages setObject:resolvedImage forKey:image];
+    os_unfair_lock_unlock(&_lock);
+
+    return resolvedImage;
+}
+
+- (void)_purgeStoredImagesIfNeeded {
+
+    // The map table keeps the keys of the images that went away, so they are removed once their number has doubled
+
+    if (_storedImages.count < _storedImagesPurgeCount) {
+        return;
+    }
+
+    for (NSNumber *key in [[_storedImages keyEnumerator] allObjects]) {
+        if ([_storedImages objectForKey:key] == nil) {
+            [_storedImages removeObjectForKey:key];
+        }
+    }
+
+    _storedImagesPurgeCount = MAX(_storedImages.count * 2, _TBImageStorePurgeCountMinimum);
+}
+
+@end
@@ -0,0 +1,61 @@
+//
+//  _TBInteractiveTransitionTracker.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private class that passes the progress of an interactive transition on once per display refresh.
+ * @discussion Touches may be delivered several times per frame (e.g. at 120 Hz), so the tracker only stores the latest progress
+ * and calls its handler on the next display refresh. The progress is extrapolated to the time the frame is going to be displayed,
+ * so whatever follows the progress keeps in step with the transition itself. The display link is paused as soon as updates stop coming.
+ */
+@interface _TBInteractiveTransitionTracker : NSObject
+
+/**
+ * @abstract Creates a tracker.
+ * @param handler A block called at most once per frame with the progress to display.
+ * @return A tracker.
+ */
+- (instancetype)initWithHandler:(void (^)(CGFloat percentComplete))handler NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @abstract Stores the latest progress of the transition. Does not call the handler.
+ * @param percentComplete The progress, between 0.0 and 1.0.
+ */
+- (void)updatePercentComplete:(CGFloat)percentComplete;
+
+/**
+ * @abstract Drops the pending progress, if any, and stops the display link. The tracker can be reused afterwards.
+ */
+- (void)stop;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,126 @@
+//
+//  _TBInteractiveTransitionTracker.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBInteractiveTransitionTracker.h"
+
+/// How far ahead of the latest sample the progress is allowed to be extrapolated
+static CFTimeInterval const _TBInteractiveTransitionTrackerMaximumPrediction = 1.0 / 60.0;
+
+/// How long the display link keeps running after the latest sample
+static CFTimeInterval const _TBInteractiveTransitionTrackerIdleInterval = 0.1;
+
+/// The weight of a new velocity sample in the smoothed velocity
+static CGFloat const _TBInteractiveTransitionTrackerVelocitySmoothing = 0.5;
+
+@implementation _TBInteractiveTransitionTracker {
+
+    void (^_handler)(CGFloat percentComplete);
+    CADisplayLink *_displayLink;
+
+    CGFloat _percentComplete;
+    CGFloat _displayedPercentComplete;
+    CGFloat _velocity; // Percent per second
+    CFTimeInterval _timestamp;
+
+    BOOL _hasSample;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithHandler:(void (^)(CGFloat))handler {
+
+    self = [super init];
+
+    if (self) {
+        _handler = [handler copy];
+        _displayedPercentComplete = -1.0;
+    }
+
+    return self;
+}
+
+#pragma mark Public Methods
+
+- (void)updatePercentComplete:(CGFloat)percentComplete {
+
+    CFTimeInterval const timestamp = CACurrentMediaTime();
+
+    if (_hasSample && timestamp > _timestamp) {
+        CGFloat const velocity = (percentComplete - _percentComplete) / (timestamp - _timestamp);
+        _velocity += (velocity - _velocity) * _TBInteractiveTransitionTrackerVelocitySmoothing;
+    } else {
+        _velocity = 0.0;
+    }
+
+    _percentComplete = percentComplete;
+    _timestamp = timestamp;
+    _hasSample = true;
+
+    if (_displayLink == nil) {
+        // The display link retains its target, so it is invalidated in `stop`
+        _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(_tick:)];
+        [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+    }
+
+    _displayLink.paused = false;
+}
+
+- (void)stop {
+
+    [_displayLink invalidate];
+
+    _displayLink = nil;
+    _hasSample = false;
+    _velocity = 0.0;
+    _displayedPercentComplete = -1.0;
+}
+
+#pragma mark Private Methods
+
+#pragma mark Display Link
+
+- (void)_tick:(CADisplayLink *)displayLink {
+
+    CFTimeInterval const targetTimestamp = displayLink.targetTimestamp;
+    CFTimeInterval const age = targetTimestamp - _timestamp;
+
+    if (age > _TBInteractiveTransitionTrackerIdleInterval) {
+        // The finger stays still, there is nothing to follow until the next sample
+        displayLink.paused = true;
+        _velocity = 0.0;
+    }
+
+    CGFloat const prediction = _velocity * MIN(MAX(age, 0.0), _TBInteractiveTransitionTrackerMaximumPrediction);
+    CGFloat const percentComplete = MAX(0.0, MIN(1.0, _percentComplete + prediction));
+
+    if (fabs(percentComplete - _displayedPercentComplete) < FLT_EPSILON) {
+        return;
+    }
+
+    _displayedPercentComplete = percentComplete;
+
+    _handler(percentComplete);
+}
+
+@end
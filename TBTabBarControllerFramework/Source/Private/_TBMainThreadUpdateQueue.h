@@ -0,0 +1,73 @@
+//
+//  _TBMainThreadUpdateQueue.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract The block a queue applies the updates with. Called on the main thread, oldest update first.
+ * @param target The object the value was written to.
+ * @param key The key of the property that was written.
+ * @param value The last value written to the property, if any.
+ * @param sequenceNumber The sequence number the write got when it was enqueued.
+ */
+typedef void (^_TBMainThreadUpdateHandler)(id target, NSUInteger key, id _Nullable value, uint64_t sequenceNumber);
+
+/**
+ * @abstract A private class that carries property writes from any thread over to the main thread.
+ * @discussion Producers push writes onto a lock-free stack with a single compare-and-swap, the main thread is the only consumer.
+ * The push that finds the stack empty schedules a drain on the main queue, so the writes of a run loop turn are drained at once.
+ * The drain keeps the last write to every property of every target and hands only those to the handler, in the order they were made.
+ */
+@interface _TBMainThreadUpdateQueue : NSObject
+
+/**
+ * @abstract Initializes a queue.
+ * @param handler The block that applies the updates on the main thread.
+ * @return An initialized queue.
+ */
+- (instancetype)initWithHandler:(_TBMainThreadUpdateHandler)handler NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @abstract Returns a sequence number that is greater than every number returned before. Safe to call from any thread.
+ * @discussion A target can record the sequence number of a write it applies right away to ignore queued writes that are older.
+ */
+- (uint64_t)nextSequenceNumber;
+
+/**
+ * @abstract Enqueues a write. Safe to call from any thread, never blocks.
+ * @param value The value that was written. Retained until the write is drained.
+ * @param key The key of the property, less than 64.
+ * @param target The object the value was written to. Retained until the write is drained.
+ */
+- (void)enqueueValue:(nullable id)value forKey:(NSUInteger)key target:(id)target;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
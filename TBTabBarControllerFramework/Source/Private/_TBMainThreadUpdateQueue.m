@@ -0,0 +1,167 @@
+//
+//  _TBMainThreadUpdateQueue.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBMainThreadUpdateQueue.h"
+
+#import <stdatomic.h>
+
+typedef struct _TBMainThreadUpdate {
+    struct _TBMainThreadUpdate *next;
+    void *target; // Retained
+    void *value; // Retained, may be NULL
+    NSUInteger key;
+    uint64_t sequenceNumber;
+} _TBMainThreadUpdate;
+
+@implementation _TBMainThreadUpdateQueue {
+
+    _TBMainThreadUpdateHandler _handler;
+
+    _Atomic(_TBMainThreadUpdate *) _head; // The most recent write
+    _Atomic(uint64_t) _sequenceNumber;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithHandler:(_TBMainThreadUpdateHandler)handler {
+
+    self = [super init];
+
+    if (self) {
+        _handler = [handler copy];
+        atomic_init(&_head, NULL);
+        atomic_init(&_sequenceNumber, 0);
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    // A scheduled drain retains the queue, so these are writes that can no longer be applied
+
+    _TBMainThreadUpdate *update = atomic_exchange_explicit(&_head, NULL, memory_order_acquire);
+
+    while (update != NULL) {
+        _TBMainThreadUpdate *next = update->next;
+        [self _freeUpdate:update];
+        update = next;
+    }
+}
+
+#pragma mark Public Methods
+
+- (uint64_t)nextSequenceNumber {
+
+    return atomic_fetch_add_explicit(&_sequenceNumber, 1, memory_order_relaxed) + 1;
+}
+
+- (void)enqueueValue:(id)value forKey:(NSUInteger)key target:(id)target {
+
+    NSParameterAssert(key < 64);
+
+    _TBMainThreadUpdate *update = malloc(sizeof(_TBMainThreadUpdate));
+
+    update->target = (void *)CFBridgingRetain(target);
+    update->value = (void *)CFBridgingRetain(value);
+    update->key = key;
+    update->sequenceNumber = [self nextSequenceNumber];
+    update->next = atomic_load_explicit(&_head, memory_order_relaxed);
+
+    while (!atomic_compare_exchange_weak_explicit(&_head, &update->next, update, memory_order_release, memory_order_relaxed)) {
+        // The head moved, `update->next` is the new one
+    }
+
+    if (update->next == NULL) {
+        // The queue was empty, so no drain is scheduled yet
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self _drain];
+        });
+    }
+}
+
+#pragma mark Private Methods
+
+- (void)_drain {
+
+    // Takes every write made so far, the newest first. Writes made from now on schedule another drain
+
+    _TBMainThreadUpdate *update = atomic_exchange_explicit(&_head, NULL, memory_order_acquire);
+
+    if (update == NULL) {
+        return;
+    }
+
+    NSUInteger count = 0;
+
+    for (_TBMainThreadUpdate *current = update; current != NULL; current = current->next) {
+        count += 1;
+    }
+
+    // Keeps the newest write to every property, the older ones are freed right away
+
+    _TBMainThreadUpdate **latestUpdates = malloc(sizeof(_TBMainThreadUpdate *) * count);
+    NSUInteger latestCount = 0;
+
+    CFMutableDictionaryRef writtenKeys = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL); // Target -> mask of written keys
+
+    while (update != NULL) {
+        _TBMainThreadUpdate *next = update->next;
+        uintptr_t const mask = (uintptr_t)CFDictionaryGetValue(writtenKeys, update->target);
+        uintptr_t const bit = (uintptr_t)1 << update->key;
+        if ((mask & bit) == 0) {
+            CFDictionarySetValue(writtenKeys, update->target, (const void *)(mask | bit));
+            latestUpdates[latestCount] = update;
+            latestCount += 1;
+        } else {
+            [self _freeUpdate:update];
+        }
+        update = next;
+    }
+
+    CFRelease(writtenKeys);
+
+    // Applies them in the order they were made
+
+    for (NSUInteger index = latestCount; index > 0; index -= 1) {
+        _TBMainThreadUpdate *latestUpdate = latestUpdates[index - 1];
+        _handler((__bridge id)latestUpdate->target, latestUpdate->key, (__bridge id)latestUpdate->value, latestUpdate->sequenceNumber);
+        [self _freeUpdate:latestUpdate];
+    }
+
+    free(latestUpdates);
+}
+
+- (void)_freeUpdate:(_TBMainThreadUpdate *)update {
+
+    CFRelease(update->target);
+
+    if (update->value != NULL) {
+        CFRelease(update->value);
+    }
+
+    free(update);
+}
+
+@end
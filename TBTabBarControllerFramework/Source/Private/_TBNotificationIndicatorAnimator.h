@@ -0,0 +1,64 @@
+//
+//  _TBNotificationIndicatorAnimator.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+@class TBTabBarButton;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private class that coalesces animated notification indicator transitions of tab bar buttons.
+ * @discussion Requests are collected during a frame and flushed once on the next display refresh in a single `CATransaction`.
+ * All presentations that share the same duration are animated in one animation block, and so are all dismissals.
+ * Opposite requests for the same button made within one frame cancel each other out, so the button is not touched at all.
+ * Nothing goes through a forced layout pass: the buttons compute the frames of their indicators directly.
+ */
+@interface _TBNotificationIndicatorAnimator : NSObject
+
+/**
+ * @abstract Returns the shared animator.
+ */
++ (instancetype)sharedAnimator;
+
+/**
+ * @abstract Schedules an animated notification indicator transition for the given button.
+ * @param hidden Indicates whether the notification indicator should be hidden.
+ * @param button The button whose notification indicator should be updated.
+ */
+- (void)setNotificationIndicatorHidden:(BOOL)hidden forButton:(TBTabBarButton *)button;
+
+/**
+ * @abstract Drops a scheduled transition for the given button, if any.
+ * @param button The button whose scheduled transition should be dropped.
+ */
+- (void)cancelNotificationIndicatorTransitionForButton:(TBTabBarButton *)button;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,179 @@
+//
+//  _TBNotificationIndicatorAnimator.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBNotificationIndicatorAnimator.h"
+#import "TBTabBarButton.h"
+#import "TBTabBarButton+Private.h"
+
+@implementation _TBNotificationIndicatorAnimator {
+
+    NSMapTable<TBTabBarButton *, NSNumber *> *_pendingTransitions; // Button -> hidden
+    CADisplayLink *_displayLink;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedAnimator {
+
+    static _TBNotificationIndicatorAnimator *sharedAnimator;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        sharedAnimator = [[_TBNotificationIndicatorAnimator alloc] _init];
+    });
+
+    return sharedAnimator;
+}
+
+- (instancetype)_init {
+
+    self = [super init];
+
+    if (self) {
+        _pendingTransitions = [NSMapTable weakToStrongObjectsMapTable];
+    }
+
+    return self;
+}
+
+#pragma mark Public Methods
+
+- (void)setNotificationIndicatorHidden:(BOOL)hidden forButton:(TBTabBarButton *)button {
+
+    NSNumber *pendingTransition = [_pendingTransitions objectForKey:button];
+
+    if (pendingTransition != nil) {
+        if (pendingTransition.boolValue != hidden) {
+            // The button gets back to its current state before anything was displayed
+            [_pendingTransitions removeObjectForKey:button];
+        }
+        return;
+    }
+
+    if (button.isNotificationIndicatorVisible != hidden) {
+        // Already there
+        return;
+    }
+
+    [_pendingTransitions setObject:@(hidden) forKey:button];
+
+    [self _scheduleFlush];
+}
+
+- (void)cancelNotificationIndicatorTransitionForButton:(TBTabBarButton *)button {
+
+    [_pendingTransitions removeObjectForKey:button];
+}
+
+#pragma mark Private Methods
+
+#pragma mark Flushing
+
+- (void)_scheduleFlush {
+
+    if (_displayLink == nil) {
+        _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(_flush:)];
+        [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+    }
+
+    _displayLink.paused = false;
+}
+
+- (void)_flush:(CADisplayLink *)displayLink {
+
+    displayLink.paused = true;
+
+    if (_pendingTransitions.count == 0) {
+        return;
+    }
+
+    NSMapTable<TBTabBarButton *, NSNumber *> *transitions = [_pendingTransitions copy];
+
+    [_pendingTransitions removeAllObjects];
+
+    // Buttons are grouped by the kind of animation and its duration, so every group is animated in one block
+
+    NSMutableDictionary<NSNumber *, NSMutableArray<TBTabBarButton *> *> *springPresentations = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSNumber *, NSMutableArray<TBTabBarButton *> *> *presentations = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSNumber *, NSMutableArray<TBTabBarButton *> *> *dismissals = [NSMutableDictionary dictionary];
+
+    [CATransaction begin];
+
+    for (TBTabBarButton *button in transitions) {
+        BOOL const hidden = [transitions objectForKey:button].boolValue;
+        BOOL const prefersSpring = [button _prepareNotificationIndicatorTransitionToHidden:hidden];
+        NSMutableDictionary<NSNumber *, NSMutableArray<TBTabBarButton *> *> *groups = hidden ? dismissals : (prefersSpring ? springPresentations : presentations);
+        NSNumber *duration = @([button notificationIndicatorAnimationDuration:!hidden]);
+        NSMutableArray<TBTabBarButton *> *group = groups[duration];
+        if (group == nil) {
+            group = [NSMutableArray array];
+            groups[duration] = group;
+        }
+        [group addObject:button];
+    }
+
+    [springPresentations enumerateKeysAndObjectsUsingBlock:^(NSNumber *duration, NSMutableArray<TBTabBarButton *> *buttons, BOOL *stop) {
+        [UIView animateWithDuration:duration.doubleValue delay:0.0 usingSpringWithDamping:0.5 initialSpringVelocity:0.25 options:UIViewAnimationOptionTransitionCrossDissolve | UIViewAnimationOptionBeginFromCurrentState animations:^{
+            [self _animateButtons:buttons toHidden:false];
+        } completion:^(BOOL finished) {
+            [self _finishButtons:buttons toHidden:false];
+        }];
+    }];
+
+    [presentations enumerateKeysAndObjectsUsingBlock:^(NSNumber *duration, NSMutableArray<TBTabBarButton *> *buttons, BOOL *stop) {
+        [UIView animateWithDuration:duration.doubleValue delay:0.0 options:UIViewAnimationOptionTransitionCrossDissolve | UIViewAnimationOptionBeginFromCurrentState animations:^{
+            [self _animateButtons:buttons toHidden:false];
+        } completion:^(BOOL finished) {
+            [self _finishButtons:buttons toHidden:false];
+        }];
+    }];
+
+    [dismissals enumerateKeysAndObjectsUsingBlock:^(NSNumber *duration, NSMutableArray<TBTabBarButton *> *buttons, BOOL *stop) {
+        [UIView animateWithDuration:duration.doubleValue delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState animations:^{
+            [self _animateButtons:buttons toHidden:true];
+        } completion:^(BOOL finished) {
+            [self _finishButtons:buttons toHidden:true];
+        }];
+    }];
+
+    [CATransaction commit];
+}
+
+#pragma mark Helpers
+
+- (void)_animateButtons:(NSArray<TBTabBarButton *> *)buttons toHidden:(BOOL)hidden {
+
+    for (TBTabBarButton *button in buttons) {
+        [button _animateNotificationIndicatorTransitionToHidden:hidden];
+    }
+}
+
+- (void)_finishButtons:(NSArray<TBTabBarButton *> *)buttons toHidden:(BOOL)hidden {
+
+    for (TBTabBarButton *button in buttons) {
+        [button _finishNotificationIndicatorTransitionToHidden:hidden];
+    }
+}
+
+@end
@@ -0,0 +1,87 @@
+//
+//  _TBSceneResources.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+@class TBTabBarAppearance;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private class that holds the rendered assets shared by all tab bar controllers of a window scene.
+ * @discussion With several windows open, scenes may live on screens with different scales, so the assets are rendered
+ * once per scene at the scale of its screen rather than at the scale of whichever scene happens to be active.
+ * The resources of a scene are dropped when the scene disconnects. Views that are not in a window scene yet
+ * (and all views before iOS 13) share a single instance that follows the current screen.
+ */
+@interface _TBSceneResources : NSObject
+
+/**
+ * @abstract The scale the assets are rendered at.
+ */
+@property (assign, nonatomic, readonly) CGFloat displayScale;
+
+/**
+ * @abstract The default separator image of simple bars.
+ */
+@property (strong, nonatomic, readonly) UIImage *separatorImage;
+
+/**
+ * @abstract Returns the resources of the scene the view is displayed in.
+ * @param view The view.
+ * @return The resources of the scene.
+ */
++ (instancetype)resourcesForView:(UIView *)view;
+
+/**
+ * @abstract Returns the resources of the scene.
+ * @param scene The window scene.
+ * @return The resources of the scene.
+ */
++ (instancetype)resourcesForScene:(UIWindowScene *)scene API_AVAILABLE(ios(13.0));
+
+/**
+ * @abstract Returns a copy of the image filled with the tint color, rendered at the scale of the scene.
+ * @discussion Buttons of both tab bars of every tab bar controller in the scene get the same image for the same source image and tint color.
+ * @param image The template image.
+ * @param tintColor The tint color. Dynamic colors should be resolved beforehand.
+ * @return The tinted image.
+ */
+- (UIImage *)tintedImage:(UIImage *)image tintColor:(UIColor *)tintColor;
+
+/**
+ * @abstract Returns an immutable snapshot of the appearance.
+ * @discussion Equal appearances applied by different tab bar controllers of the scene share the same snapshot.
+ * @param appearance The appearance.
+ * @return The snapshot of the appearance.
+ */
+- (TBTabBarAppearance *)snapshotOfAppearance:(TBTabBarAppearance *)appearance;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,208 @@
+//
+//  _TBSceneResources.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBSceneResources.h"
+#import "TBTabBarAppearance.h"
+#import "UIApplication+Extensions.h"
+#import "_TBUtils.h"
+
+@implementation _TBSceneResources {
+
+    __weak UIWindowScene *_scene API_AVAILABLE(ios(13.0));
+
+    CGFloat _renderedScale; // The scale the cached assets were rendered at
+
+    UIImage *_separatorImage;
+    NSMapTable<UIImage *, NSMutableDictionary<UIColor *, UIImage *> *> *_tintedImages; // Source image -> (tint color -> tinted image)
+    TBTabBarAppearance *_appearanceSnapshot;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)resourcesForView:(UIView *)view {
+
+    if (@available(iOS 13.0, *)) {
+        UIWindowScene *scene = view.window.windowScene;
+        if (scene != nil) {
+            return [self resourcesForScene:scene];
+        }
+    }
+
+    return [self _sharedResources];
+}
+
++ (instancetype)resourcesForScene:(UIWindowScene *)scene {
+
+    NSMapTable<UIWindowScene *, _TBSceneResources *> *registry = [self _registry];
+
+    _TBSceneResources *resources = [registry objectForKey:scene];
+
+    if (resources == nil) {
+        resources = [[_TBSceneResources alloc] _initWithScene:scene];
+        [registry setObject:resources forKey:scene];
+    }
+
+    return resources;
+}
+
++ (instancetype)_sharedResources {
+
+    static _TBSceneResources *sharedResources;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        sharedResources = [[_TBSceneResources alloc] _initWithScene:nil];
+    });
+
+    return sharedResources;
+}
+
++ (NSMapTable *)_registry API_AVAILABLE(ios(13.0)) {
+
+    static NSMapTable<UIWindowScene *, _TBSceneResources *> *registry;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        registry = [NSMapTable weakToStrongObjectsMapTable];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_sceneDidDisconnect:) name:UISceneDidDisconnectNotification object:nil];
+    });
+
+    return registry;
+}
+
+- (instancetype)_initWithScene:(UIWindowScene *)scene {
+
+    self = [super init];
+
+    if (self) {
+        if (@available(iOS 13.0, *)) {
+            _scene = scene;
+        }
+        _tintedImages = [NSMapTable weakToStrongObjectsMapTable];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+
+    return self;
+}
+
+#pragma mark Public Methods
+
+- (UIImage *)tintedImage:(UIImage *)image tintColor:(UIColor *)tintColor {
+
+    CGFloat const displayScale = [self _validatedScale];
+
+    NSMutableDictionary<UIColor *, UIImage *> *tintedImages = [_tintedImages objectForKey:image];
+
+    if (tintedImages == nil) {
+        tintedImages = [NSMutableDictionary dictionaryWithCapacity:2];
+        [_tintedImages setObject:tintedImages forKey:image];
+    }
+
+    UIImage *tintedImage = tintedImages[tintColor];
+
+    if (tintedImage == nil) {
+        tintedImage = _TBDrawImageWithTintColor(image, tintColor, displayScale);
+        tintedImages[tintColor] = tintedImage;
+    }
+
+    return tintedImage;
+}
+
+- (TBTabBarAppearance *)snapshotOfAppearance:(TBTabBarAppearance *)appearance {
+
+    if (_appearanceSnapshot == nil || ![_appearanceSnapshot isEqualToAppearance:appearance]) {
+        _appearanceSnapshot = [appearance copy];
+    }
+
+    return _appearanceSnapshot;
+}
+
+#pragma mark Private Methods
+
+#pragma mark Helpers
+
+/// Drops the rendered assets if the scene has moved to a screen with a different scale
+- (CGFloat)_validatedScale {
+
+    CGFloat const displayScale = self.displayScale;
+
+    if (_renderedScale != displayScale) {
+        [self _purge];
+        _renderedScale = displayScale;
+    }
+
+    return displayScale;
+}
+
+- (void)_purge {
+
+    _separatorImage = nil;
+    [_tintedImages removeAllObjects];
+}
+
+#pragma mark Notifications
+
++ (void)_sceneDidDisconnect:(NSNotification *)notification API_AVAILABLE(ios(13.0)) {
+
+    UIScene *scene = notification.object;
+
+    if ([scene isKindOfClass:[UIWindowScene class]]) {
+        [[self _registry] removeObjectForKey:scene];
+    }
+}
+
+- (void)_didReceiveMemoryWarning:(NSNotification *)notification {
+
+    [self _purge];
+}
+
+#pragma mark Getters
+
+- (CGFloat)displayScale {
+
+    UIScreen *screen;
+
+    if (@available(iOS 13.0, *)) {
+        screen = _scene.screen;
+    }
+
+    if (screen == nil) {
+        screen = [UIApplication sharedApplication].currentScreen;
+    }
+
+    return screen != nil ? screen.nativeScale : 2.0;
+}
+
+- (UIImage *)separatorImage {
+
+    CGFloat const displayScale = [self _validatedScale];
+
+    if (_separatorImage == nil) {
+        _separatorImage = _TBDrawFilledRectangleWithSize((CGSize){displayScale, displayScale});
+    }
+
+    return _separatorImage;
+}
+
+@end
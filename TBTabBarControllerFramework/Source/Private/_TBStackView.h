@@ -63,11 +63,42 @@ typedef NS_ENUM(NSInteger, TBStackedTabsViewAxis) {
  */
 @property (assign, nonatomic, readonly, getter = isVertical) BOOL vertical NS_SWIFT_NAME(isVertical);
 
+/**
+ * @abstract Indicates whether a subview is being dragged to a new place.
+ */
+@property (assign, nonatomic, readonly, getter = isReordering) BOOL reordering;
+
 /**
  * @abstract Marks the stack view as needing layout, triggering a layout update.
  */
 - (void)setNeedsLayout;
 
+/**
+ * @abstract Starts dragging the subview at the given index. The subview is raised above its neighbours.
+ * @discussion The frames computed by the layout kernel are kept until the layout is invalidated,
+ * so the updates that follow neither run the kernel nor allocate memory.
+ * @param index The index of the subview to drag.
+ */
+- (void)beginReorderingSubviewAtIndex:(NSUInteger)index;
+
+/**
+ * @abstract Moves the dragged subview along the axis. The neighbours it passes over slide to their new places.
+ * @param translation The distance from the original place of the subview along the axis.
+ * @return The index the dragged subview would take if the drag ended now.
+ */
+- (NSUInteger)updateReorderingWithTranslation:(CGFloat)translation;
+
+/**
+ * @abstract Drops the dragged subview into its new place and moves it to the matching index among the subviews.
+ * @return The new index of the dragged subview, or `NSNotFound` if nothing is being dragged.
+ */
+- (NSUInteger)endReordering;
+
+/**
+ * @abstract Puts every subview back into its original place.
+ */
+- (void)cancelReordering;
+
 @end
 
 NS_ASSUME_NONNULL_END
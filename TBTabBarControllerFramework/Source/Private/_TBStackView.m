@@ -24,23 +24,23 @@
 
 #import "_TBStackView.h"
 #import "TBTabBarButton.h"
-#import "_TBUtils.h"
+#import "_TBStackViewLayout.h"
 #import "UIView+Extensions.h"
 
-typedef NS_ENUM(NSUInteger, _TBStackViewPixelDistributionRule) {
-    _TBStackViewPixelDistributionRuleStraight,
-    _TBStackViewPixelDistributionRuleEven,
-    _TBStackViewPixelDistributionRuleOdd
-};
-
-typedef struct _TBStackViewPixelDistribution {
-    _TBStackViewPixelDistributionRule rule;
-    NSUInteger pixelsCount;
-} _TBStackViewPixelDistribution;
+static NSTimeInterval const _TBStackViewReorderingAnimationDuration = 0.2;
 
 @implementation _TBStackView {
 
+    _TBStackViewLayoutFunction _layout; // Picked once, so the layout pass never branches on the axis
+    _TBStackViewAxisGeometry _geometry; // Picked along with the kernel, for the reordering
+    CGRect *_slots; // The frames computed by the kernel, kept until the layout is invalidated
+    NSUInteger _slotsCapacity;
+    NSUInteger _slotsCount;
+    __weak UIView *_reorderedSubview;
+    NSUInteger _reorderingSourceIndex;
+    NSUInteger _reorderingDestinationIndex;
     BOOL _needsLayout;
+    BOOL _needsUpdateSlots;
 }
 
 #pragma mark Lifecycle
@@ -81,153 +81,175 @@ typedef struct _TBStackViewPixelDistribution {
     return self;
 }
 
-#pragma mark Overrides
+- (void)dealloc {
 
-- (void)setNeedsLayout {
+    free(_slots);
+}
 
-    [super setNeedsLayout];
+#pragma mark Public Methods
 
-    [self _setNeedsLayout];
+- (void)beginReorderingSubviewAtIndex:(NSUInteger)index {
+
+    [self cancelReordering];
+    [self layoutIfNeeded];
+
+    _reorderedSubview = self.subviews[index];
+    _reorderedSubview.layer.zPosition = 1.0;
+    _reorderingSourceIndex = index;
+    _reorderingDestinationIndex = index;
 }
 
-- (void)layoutSubviews {
+- (NSUInteger)updateReorderingWithTranslation:(CGFloat)translation {
 
-    [super layoutSubviews];
+    UIView *reorderedSubview = _reorderedSubview;
 
-    if (_needsLayout == false) {
-        return;
+    if (reorderedSubview == nil) {
+        return NSNotFound;
     }
 
-    _needsLayout = false;
+    [self _updateSlotsIfNeeded];
 
-    NSArray<TBTabBarButton *> *subviews = self.subviews;
-    NSUInteger const tabsCount = subviews.count;
+    _TBStackViewAxisGeometry const geometry = _geometry;
+    NSUInteger const count = _slotsCount;
 
-    if (tabsCount == 0) {
-        return;
+    // The dragged subview stays within the stack
+
+    CGRect const frame = _slots[_reorderingSourceIndex];
+
+    CGFloat const length = geometry.length(frame);
+    CGFloat const minOrigin = geometry.leadingEdge(_slots[0]);
+    CGFloat const maxOrigin = geometry.trailingEdge(_slots[count - 1]) - length;
+    CGFloat const origin = MIN(MAX(geometry.leadingEdge(frame) + translation, minOrigin), maxOrigin);
+
+    reorderedSubview.frame = geometry.rectWithLeadingEdge(frame, origin);
+
+    // The destination moves a slot at a time, once the center of the subview crosses the middle of the space between two slots
+
+    CGFloat const center = origin + (length / 2.0);
+    NSUInteger const previousDestinationIndex = _reorderingDestinationIndex;
+    NSUInteger destinationIndex = previousDestinationIndex;
+
+    while (destinationIndex + 1 < count && center >= (geometry.trailingEdge(_slots[destinationIndex]) + geometry.leadingEdge(_slots[destinationIndex + 1])) / 2.0) {
+        destinationIndex += 1;
     }
 
-    CGFloat const width = CGRectGetWidth(self.bounds);
-    CGFloat const height = CGRectGetHeight(self.bounds);
-    CGFloat const displayScale = self.tb_displayScale;
-    CGFloat const pixelSize = (1.0 / displayScale);
-    CGFloat const spacing = self.spacing;
-    CGFloat const totalSpacing = (spacing * (tabsCount - 1));
-    BOOL const isVertical = self.isVertical;
-
-    CGRect frames[tabsCount];
-
-    if (isVertical) {
-        CGFloat const maxTabHeight = (height - totalSpacing) / (CGFloat)tabsCount;
-        for (NSInteger index = 0; index < tabsCount; index += 1) {
-            frames[index] = (CGRect){
-                {0.0, ((_TBPixelAccurateValue(maxTabHeight, displayScale, true) + _TBPixelAccurateValue(spacing, displayScale, true)) * (CGFloat)index)},
-                {width, _TBPixelAccurateValue(maxTabHeight, displayScale, true)}
-            };
-        }
-    } else {
-        CGFloat const maxTabWidth = (width - totalSpacing) / (CGFloat)tabsCount;
-        for (NSInteger index = 0; index < tabsCount; index += 1) {
-            frames[index] = (CGRect){
-                {((_TBPixelAccurateValue(maxTabWidth, displayScale, true) + _TBPixelAccurateValue(spacing, displayScale, true)) * (CGFloat)index), 0.0},
-                {_TBPixelAccurateValue(maxTabWidth, displayScale, true), height}
-            };
-        }
+    while (destinationIndex > 0 && center < (geometry.trailingEdge(_slots[destinationIndex - 1]) + geometry.leadingEdge(_slots[destinationIndex])) / 2.0) {
+        destinationIndex -= 1;
     }
 
-    NSUInteger undistributedPixelsCount = (NSUInteger)ceil(MAX(0.0, (isVertical ? height - CGRectGetMaxY(frames[tabsCount - 1]) : width -CGRectGetMaxX(frames[tabsCount - 1]))) / pixelSize);
+    if (destinationIndex == previousDestinationIndex) {
+        return destinationIndex;
+    }
+
+    _reorderingDestinationIndex = destinationIndex;
 
-    if (undistributedPixelsCount > 0) {
+    // Only the subviews between the previous and the new destination change their places
 
-        NSUInteger const distributionRowsCount = (NSUInteger)ceil((CGFloat)undistributedPixelsCount / (CGFloat)tabsCount);
-        _TBStackViewPixelDistribution distributionRows[distributionRowsCount];
+    NSArray<UIView *> *subviews = self.subviews;
+    NSUInteger const firstIndex = MIN(previousDestinationIndex, destinationIndex);
+    NSUInteger const lastIndex = MAX(previousDestinationIndex, destinationIndex);
 
-        for (NSUInteger row = 0; row < distributionRowsCount; row += 1) {
-            NSUInteger const undistributedPixelsCountInRow = MIN(undistributedPixelsCount, tabsCount);
-            NSUInteger const amountOfEvenNumbers = _TBAmountOfEvenNumbersInRange(NSMakeRange(1, tabsCount));
-            NSUInteger const amountOfOddNumbers = tabsCount - amountOfEvenNumbers;
-            BOOL const isEven = undistributedPixelsCountInRow % 2 == 0;
-            if (isEven && amountOfEvenNumbers >= undistributedPixelsCountInRow) {
-                distributionRows[row] = (_TBStackViewPixelDistribution){_TBStackViewPixelDistributionRuleEven, undistributedPixelsCountInRow};
-            } else if (!isEven && amountOfOddNumbers >= undistributedPixelsCountInRow) {
-                distributionRows[row] = (_TBStackViewPixelDistribution){_TBStackViewPixelDistributionRuleOdd, undistributedPixelsCountInRow};
-            } else {
-                distributionRows[row] = (_TBStackViewPixelDistribution){_TBStackViewPixelDistributionRuleStraight, undistributedPixelsCountInRow};
+    [UIView animateWithDuration:_TBStackViewReorderingAnimationDuration delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState | UIViewAnimationOptionAllowUserInteraction animations:^{
+        for (NSUInteger index = firstIndex; index <= lastIndex; index += 1) {
+            UIView *subview = subviews[index];
+            if (subview != reorderedSubview) {
+                subview.frame = self->_slots[[self _slotIndexOfSubviewAtIndex:index]];
             }
-            undistributedPixelsCount -= undistributedPixelsCountInRow;
         }
+    } completion:nil];
+
+    return destinationIndex;
+}
 
-        CGPoint offset = CGPointZero;
-        NSUInteger distributedPixelsCount[distributionRowsCount];
+- (NSUInteger)endReordering {
 
-        for (NSUInteger row = 0; row < distributionRowsCount; row += 1) {
-            distributedPixelsCount[row] = 0;
-        }
+    UIView *reorderedSubview = _reorderedSubview;
 
-        for (NSInteger index = 0; index < tabsCount; index += 1) {
-
-            CGRect frame = frames[index];
-            CGRect newFrame = CGRectZero;
-            CGFloat axisOffset = 0.0;
-
-            for (NSUInteger row = 0; row < distributionRowsCount; row += 1) {
-                _TBStackViewPixelDistribution const distributionRow = distributionRows[row];
-                if (distributionRow.pixelsCount > distributedPixelsCount[row]) {
-                    switch (distributionRow.rule) {
-                        case _TBStackViewPixelDistributionRuleStraight:
-                            axisOffset += pixelSize;
-                            distributedPixelsCount[row] += 1;
-                            break;
-
-                        case _TBStackViewPixelDistributionRuleEven:
-                            if ((index + 1) % 2 == 0) {
-                                axisOffset += pixelSize;
-                                distributedPixelsCount[row] += 1;
-                            }
-                            break;
-
-                        case _TBStackViewPixelDistributionRuleOdd:
-                            if ((index + 1) % 2 != 0) {
-                                axisOffset += pixelSize;
-                                distributedPixelsCount[row] += 1;
-                            }
-                            break;
-
-                        default:
-                            break;
-                    }
-                }
-            }
+    if (reorderedSubview == nil) {
+        return NSNotFound;
+    }
 
-            if (axisOffset > 0.0) {
-                CGSize newSize = frame.size;
-                CGPoint newOffset = offset;
-                if (isVertical) {
-                    newSize.height += axisOffset;
-                    newOffset.y += axisOffset;
-                } else {
-                    newSize.width += axisOffset;
-                    newOffset.x += axisOffset;
-                }
-                newFrame = (CGRect){{frame.origin.x + offset.x, frame.origin.y + offset.y}, newSize};
-                offset = newOffset;
-            }
+    NSUInteger const destinationIndex = _reorderingDestinationIndex;
 
-            if (offset.x > 0.0 || offset.y > 0.0) {
-                if (CGRectEqualToRect(newFrame, CGRectZero)) {
-                    // Shift only next frames due size changes of previous ones since they're already corrected
-                    newFrame = frame;
-                    newFrame.origin = (CGPoint){newFrame.origin.x + offset.x, newFrame.origin.y + offset.y};
-                }
-                frames[index] = newFrame;
-            }
+    _reorderedSubview = nil;
+
+    if (destinationIndex != _reorderingSourceIndex) {
+        // The subview is taken out first, so it ends up exactly at the destination index
+        [self insertSubview:reorderedSubview atIndex:destinationIndex];
+    }
+
+    [self _updateSlotsIfNeeded];
+
+    CGRect const frame = _slots[destinationIndex];
+
+    [UIView animateWithDuration:_TBStackViewReorderingAnimationDuration delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState | UIViewAnimationOptionAllowUserInteraction animations:^{
+        reorderedSubview.frame = frame;
+    } completion:^(BOOL finished) {
+        reorderedSubview.layer.zPosition = 0.0;
+    }];
+
+    return destinationIndex;
+}
+
+- (void)cancelReordering {
+
+    UIView *reorderedSubview = _reorderedSubview;
+
+    if (reorderedSubview == nil) {
+        return;
+    }
+
+    _reorderedSubview = nil;
+
+    [self _updateSlotsIfNeeded];
+
+    NSArray<UIView *> *subviews = self.subviews;
+    NSUInteger const count = _slotsCount;
+
+    [UIView animateWithDuration:_TBStackViewReorderingAnimationDuration delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState | UIViewAnimationOptionAllowUserInteraction animations:^{
+        for (NSUInteger index = 0; index < count; index += 1) {
+            subviews[index].frame = self->_slots[index];
         }
+    } completion:^(BOOL finished) {
+        reorderedSubview.layer.zPosition = 0.0;
+    }];
+}
+
+#pragma mark Overrides
+
+- (void)setNeedsLayout {
+
+    [super setNeedsLayout];
+
+    [self _setNeedsLayout];
+}
+
+- (void)layoutSubviews {
+
+    [super layoutSubviews];
+
+    if (_needsLayout == false) {
+        return;
     }
 
-    NSInteger index = 0;
+    _needsLayout = false;
+
+    NSArray<TBTabBarButton *> *subviews = self.subviews;
+
+    if (subviews.count == 0) {
+        return;
+    }
+
+    [self _updateSlotsIfNeeded];
+
+    UIView *reorderedSubview = _reorderedSubview;
+    NSUInteger index = 0;
 
     for (TBTabBarButton *subview in subviews) {
-        subview.frame = frames[index];
+        // The dragged subview follows the touch, it is put in place on the next update
+        if (subview != reorderedSubview) {
+            subview.frame = _slots[[self _slotIndexOfSubviewAtIndex:index]];
+        }
         index += 1;
     }
 }
@@ -265,8 +287,11 @@ typedef struct _TBStackViewPixelDistribution {
 #pragma mark Setup
 
 - (void)_commonInit {
+    _layout = _vertical ? _TBStackViewVerticalLayout : _TBStackViewHorizontalLayout;
+    _geometry = _vertical ? _TBStackViewVerticalGeometry : _TBStackViewHorizontalGeometry;
     _spacing = 4.0;
     _needsLayout = false;
+    _needsUpdateSlots = true;
 }
 
 #pragma mark Layout
@@ -276,6 +301,62 @@ typedef struct _TBStackViewPixelDistribution {
     if (!_needsLayout) {
         _needsLayout = true;
     }
+
+    _needsUpdateSlots = true;
+}
+
+- (void)_updateSlotsIfNeeded {
+
+    NSUInteger const count = self.subviews.count;
+
+    if (_needsUpdateSlots == false && _slotsCount == count) {
+        return;
+    }
+
+    if (count > _slotsCapacity) {
+        _slots = realloc(_slots, count * sizeof(CGRect));
+        _slotsCapacity = count;
+    }
+
+    _slotsCount = count;
+    _needsUpdateSlots = false;
+
+    _layout(_slots, count, self.bounds.size, self.spacing, self.tb_displayScale);
+}
+
+#pragma mark Reordering
+
+- (NSUInteger)_slotIndexOfSubviewAtIndex:(NSUInteger)index {
+
+    if (_reorderedSubview == nil) {
+        return index;
+    }
+
+    NSUInteger const sourceIndex = _reorderingSourceIndex;
+    NSUInteger const destinationIndex = _reorderingDestinationIndex;
+
+    if (index == sourceIndex) {
+        return destinationIndex;
+    }
+
+    // The subviews between the source and the destination make room for the dragged one
+
+    if (sourceIndex < destinationIndex && index > sourceIndex && index <= destinationIndex) {
+        return index - 1;
+    }
+
+    if (destinationIndex < sourceIndex && index >= destinationIndex && index < sourceIndex) {
+        return index + 1;
+    }
+
+    return index;
+}
+
+#pragma mark Getters
+
+- (BOOL)isReordering {
+
+    return _reorderedSubview != nil;
 }
 
 #pragma mark Setters
@@ -0,0 +1,71 @@
+//
+//  _TBStackViewLayout.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A layout kernel that computes the frames of tabs stacked along one axis.
+ * @discussion Every tab gets the same pixel-accurate length. The pixels left over at the end of the stack are handed out to the tabs,
+ * a row at a time: a full row gives one pixel to every tab, while the last row prefers every other tab, so the extra pixels are spread evenly.
+ * @param frames The buffer to write the frames to. Must be able to hold `count` frames.
+ * @param count The number of tabs.
+ * @param size The size of the stack.
+ * @param spacing The spacing between tabs.
+ * @param scale The scale to align the frames to.
+ */
+typedef void (*_TBStackViewLayoutFunction)(CGRect *frames, NSUInteger count, CGSize size, CGFloat spacing, CGFloat scale);
+
+/**
+ * @abstract The kernel that stacks tabs from left to right.
+ */
+FOUNDATION_EXTERN _TBStackViewLayoutFunction const _TBStackViewHorizontalLayout;
+
+/**
+ * @abstract The kernel that stacks tabs from top to bottom.
+ */
+FOUNDATION_EXTERN _TBStackViewLayoutFunction const _TBStackViewVerticalLayout;
+
+/**
+ * @abstract Reads and moves frames along the axis of a stack, so the code outside of the kernels never branches on the axis either.
+ */
+typedef struct {
+    CGFloat (*length)(CGRect rect); // The length of the rect along the axis
+    CGFloat (*leadingEdge)(CGRect rect); // The minimum coordinate of the rect along the axis
+    CGFloat (*trailingEdge)(CGRect rect); // The maximum coordinate of the rect along the axis
+    CGRect (*rectWithLeadingEdge)(CGRect rect, CGFloat leadingEdge); // The rect moved along the axis
+} _TBStackViewAxisGeometry;
+
+/**
+ * @abstract The geometry of the horizontal axis, which matches `_TBStackViewHorizontalLayout`.
+ */
+FOUNDATION_EXTERN _TBStackViewAxisGeometry const _TBStackViewHorizontalGeometry;
+
+/**
+ * @abstract The geometry of the vertical axis, which matches `_TBStackViewVerticalLayout`.
+ */
+FOUNDATION_EXTERN _TBStackViewAxisGeometry const _TBStackViewVerticalGeometry;
+
+NS_ASSUME_NONNULL_END
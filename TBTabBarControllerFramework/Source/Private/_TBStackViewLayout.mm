@@ -0,0 +1,133 @@
+//
+//  _TBStackViewLayout.mm
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "_TBStackViewLayout.h"
+#import "_TBUtils.h"
+
+namespace {
+
+/// Reads and writes the geometry along the horizontal axis
+struct _TBHorizontalAxis {
+
+    static inline CGFloat length(CGSize size) { return size.width; }
+
+    static inline CGFloat crossLength(CGSize size) { return size.height; }
+
+    static inline CGRect rect(CGFloat origin, CGFloat length, CGFloat crossLength) {
+        return (CGRect){{origin, 0.0}, {length, crossLength}};
+    }
+
+    static CGFloat rectLength(CGRect rect) { return CGRectGetWidth(rect); }
+
+    static CGFloat leadingEdge(CGRect rect) { return CGRectGetMinX(rect); }
+
+    static CGFloat trailingEdge(CGRect rect) { return CGRectGetMaxX(rect); }
+
+    static CGRect rectWithLeadingEdge(CGRect rect, CGFloat leadingEdge) {
+        rect.origin.x = leadingEdge;
+        return rect;
+    }
+};
+
+/// Reads and writes the geometry along the vertical axis
+struct _TBVerticalAxis {
+
+    static inline CGFloat length(CGSize size) { return size.height; }
+
+    static inline CGFloat crossLength(CGSize size) { return size.width; }
+
+    static inline CGRect rect(CGFloat origin, CGFloat length, CGFloat crossLength) {
+        return (CGRect){{0.0, origin}, {crossLength, length}};
+    }
+
+    static CGFloat rectLength(CGRect rect) { return CGRectGetHeight(rect); }
+
+    static CGFloat leadingEdge(CGRect rect) { return CGRectGetMinY(rect); }
+
+    static CGFloat trailingEdge(CGRect rect) { return CGRectGetMaxY(rect); }
+
+    static CGRect rectWithLeadingEdge(CGRect rect, CGFloat leadingEdge) {
+        rect.origin.y = leadingEdge;
+        return rect;
+    }
+};
+
+template <typename Axis>
+void _TBStackViewLayout(CGRect *frames, NSUInteger count, CGSize size, CGFloat spacing, CGFloat scale) {
+
+    if (count == 0) {
+        return;
+    }
+
+    CGFloat const length = Axis::length(size);
+    CGFloat const crossLength = Axis::crossLength(size);
+    CGFloat const pixelSize = (1.0 / scale);
+
+    CGFloat const tabLength = _TBPixelAccurateValue((length - (spacing * (CGFloat)(count - 1))) / (CGFloat)count, scale, true);
+    CGFloat const step = tabLength + _TBPixelAccurateValue(spacing, scale, true);
+
+    // The pixels left over at the end of the stack are distributed in rows of at most `count` pixels.
+    // Every full row gives a pixel to every tab, so only the last one has to pick the tabs.
+
+    CGFloat const overflow = length - ((step * (CGFloat)(count - 1)) + tabLength);
+    NSUInteger const undistributedPixelsCount = (NSUInteger)ceil(MAX(0.0, overflow) / pixelSize);
+    NSUInteger const fullRowsCount = undistributedPixelsCount / count;
+    NSUInteger const remainingPixelsCount = undistributedPixelsCount % count;
+
+    // The last row gives its pixels to every other tab (either the 1st, 3rd, ... or the 2nd, 4th, ... ones,
+    // whichever matches the parity of the pixels count) if there are enough of them, to the leading tabs otherwise
+
+    NSUInteger const evenTabsCount = count / 2;
+    NSUInteger const oddTabsCount = count - evenTabsCount;
+    BOOL const isEven = (remainingPixelsCount % 2 == 0);
+    BOOL const isAlternating = isEven ? (evenTabsCount >= remainingPixelsCount) : (oddTabsCount >= remainingPixelsCount);
+
+    NSUInteger const parityMask = isAlternating ? 1 : 0;
+    NSUInteger const parity = (isAlternating && isEven) ? 1 : 0;
+    NSUInteger const limit = isAlternating ? (remainingPixelsCount * 2) : remainingPixelsCount;
+
+    CGFloat const rowsLength = pixelSize * (CGFloat)fullRowsCount;
+    CGFloat offset = 0.0;
+
+    for (NSUInteger index = 0; index < count; index += 1) {
+        BOOL const receivesPixel = (index < limit) & ((index & parityMask) == parity);
+        CGFloat const extraLength = rowsLength + (pixelSize * (CGFloat)receivesPixel);
+        frames[index] = Axis::rect((step * (CGFloat)index) + offset, tabLength + extraLength, crossLength);
+        offset += extraLength;
+    }
+}
+
+template <typename Axis>
+constexpr _TBStackViewAxisGeometry _TBStackViewGeometry() {
+
+    return {&Axis::rectLength, &Axis::leadingEdge, &Axis::trailingEdge, &Axis::rectWithLeadingEdge};
+}
+
+} // namespace
+
+_TBStackViewLayoutFunction const _TBStackViewHorizontalLayout = &_TBStackViewLayout<_TBHorizontalAxis>;
+_TBStackViewLayoutFunction const _TBStackViewVerticalLayout = &_TBStackViewLayout<_TBVerticalAxis>;
+
+_TBStackViewAxisGeometry const _TBStackViewHorizontalGeometry = _TBStackViewGeometry<_TBHorizontalAxis>();
+_TBStackViewAxisGeometry const _TBStackViewVerticalGeometry = _TBStackViewGeometry<_TBVerticalAxis>();
@@ -128,6 +128,17 @@ extern BOOL _TBSubclassOverridesMethod(Class superclass, Class subclass, SEL sel
  */
 extern void _TBSwizzleMethod(Class class, SEL originalSelector, SEL swizzledSelector);
 
+/**
+ * @abstract Returns a subclass of a class whose instances opt in to custom behavior one by one, creating it on first use.
+ * @discussion Set the returned subclass as the class of an instance with `object_setClass` to apply the overrides to that instance only,
+ * so the rest of the instances of the class do not pay for them. Just like KVO subclasses, the subclass reports the original class from `-class`.
+ * @param class The class to subclass.
+ * @param prefix The prefix of the subclass name.
+ * @param configurationHandler A block that adds overrides to the subclass. Called once, before the subclass is registered.
+ * @return The subclass, or `nil` if the runtime failed to create it.
+ */
+extern Class _Nullable _TBInstanceSubclass(Class class, NSString *prefix, void (^configurationHandler)(Class subclass));
+
 #pragma mark - Calculations
 
 /**
@@ -154,4 +165,15 @@ extern UIImage *_TBDrawFilledRectangleWithSize(CGSize size);
  */
 extern UIImage *_TBDrawFilledCircleWithSize(CGSize size, CGFloat scale);
 
+/**
+ * @abstract Draws the given image filled with the specified tint color.
+ * @discussion The alpha channel of the image is used as a mask, so the result looks the same as a template image
+ * displayed by an image view with the same tint color.
+ * @param image The image to draw.
+ * @param tintColor The color to fill the image with.
+ * @param scale The scale to use for drawing.
+ * @return An image filled with the tint color.
+ */
+extern UIImage *_TBDrawImageWithTintColor(UIImage *image, UIColor *tintColor, CGFloat scale);
+
 NS_ASSUME_NONNULL_END
@@ -51,6 +51,35 @@ void _TBSwizzleMethod(Class class, SEL originalSelector, SEL swizzledSelector) {
     }
 }
 
+Class _TBInstanceSubclass(Class class, NSString *prefix, void (^configurationHandler)(Class subclass)) {
+
+    NSString *name = [prefix stringByAppendingString:NSStringFromClass(class)];
+    Class subclass = NSClassFromString(name);
+
+    if (subclass != nil) {
+        return subclass;
+    }
+
+    subclass = objc_allocateClassPair(class, name.UTF8String, 0);
+
+    if (subclass == nil) {
+        return nil;
+    }
+
+    Method const classMethod = class_getInstanceMethod(class, @selector(class));
+    IMP const classImplementation = imp_implementationWithBlock(^Class(id object) {
+        return class;
+    });
+
+    class_addMethod(subclass, @selector(class), classImplementation, method_getTypeEncoding(classMethod));
+
+    configurationHandler(subclass);
+
+    objc_registerClassPair(subclass);
+
+    return subclass;
+}
+
 #pragma mark - Calculations
 
 NSUInteger _TBAmountOfEvenNumbersInRange(NSRange range) {
@@ -83,3 +112,22 @@ UIImage *_TBDrawFilledCircleWithSize(CGSize size, CGFloat scale) {
 
     return [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
 }
+
+UIImage *_TBDrawImageWithTintColor(UIImage *image, UIColor *tintColor, CGFloat scale) {
+
+    CGSize const size = image.size;
+
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = scale;
+    format.opaque = false;
+
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:size format:format];
+    UIImage *tintedImage = [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        CGRect const rect = (CGRect){CGPointZero, size};
+        [tintColor setFill];
+        UIRectFill(rect);
+        [image drawInRect:rect blendMode:kCGBlendModeDestinationIn alpha:1.0];
+    }];
+
+    return tintedImage;
+}
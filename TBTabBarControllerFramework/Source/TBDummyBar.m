@@ -26,7 +26,12 @@
 #import "_TBUtils.h"
 #import "UIView+Extensions.h"
 
-@implementation TBDummyBar
+@implementation TBDummyBar {
+
+    CGSize tbfknvbr_proposedSubviewSize; // The size the cached fitting size was computed for
+    CGSize tbfknvbr_fittingSubviewSize;
+    BOOL tbfknvbr_hasFittingSubviewSize;
+}
 
 #pragma mark - Public
 
@@ -54,8 +59,25 @@
     return self;
 }
 
+#pragma mark Public Methods
+
+- (void)invalidateSubviewSize {
+
+    tbfknvbr_hasFittingSubviewSize = false;
+
+    [self setNeedsLayout];
+}
+
 #pragma mark Overrides
 
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // The subview may size its content after the traits, e.g. the content size category
+    [self invalidateSubviewSize];
+}
+
 - (void)layoutSubviews {
 
     [super layoutSubviews];
@@ -68,9 +90,14 @@
     UIEdgeInsets const contentInsets = self.contentInsets;
 
     UIView *subview = self.subview;
-    CGRect frame = subview.frame;
 
-    frame.size = [subview sizeThatFits:(CGSize){
+    if (subview == nil) {
+        return;
+    }
+
+    CGRect frame;
+
+    frame.size = [self tbfknvbr_fittingSubviewSizeForProposedSize:(CGSize){
         width - safeAreaInsets.left - safeAreaInsets.right - contentInsets.left,
         height - contentInsets.top - contentInsets.bottom - safeAreaInsets.top}
     ];
@@ -79,7 +106,11 @@
         height + contentInsets.top - contentInsets.bottom - frame.size.height
     };
 
-    subview.frame = _TBPixelAccurateRect(frame, displayScale, true);
+    frame = _TBPixelAccurateRect(frame, displayScale, true);
+
+    if (!CGRectEqualToRect(subview.frame, frame)) {
+        subview.frame = frame;
+    }
 }
 
 #pragma mark Private Methods
@@ -91,6 +122,20 @@
     self.contentInsets = UIEdgeInsetsMake(0.0, 0.0, 6.0, 0.0);
 }
 
+#pragma mark Layout
+
+- (CGSize)tbfknvbr_fittingSubviewSizeForProposedSize:(CGSize)proposedSize {
+
+    // The frame of the bar changes on every frame of interactive pops and rotations, while the size proposed to the subview rarely does
+    if (!tbfknvbr_hasFittingSubviewSize || !CGSizeEqualToSize(tbfknvbr_proposedSubviewSize, proposedSize)) {
+        tbfknvbr_proposedSubviewSize = proposedSize;
+        tbfknvbr_fittingSubviewSize = [self.subview sizeThatFits:proposedSize];
+        tbfknvbr_hasFittingSubviewSize = true;
+    }
+
+    return tbfknvbr_fittingSubviewSize;
+}
+
 #pragma mark Setters
 
 - (void)setSubview:(__kindof UIView *)subview {
@@ -102,6 +147,8 @@
     }
 
     _subview = subview;
+
+    [self invalidateSubviewSize];
 }
 
 @end
@@ -24,9 +24,17 @@
 
 #import "TBSimpleBar.h"
 #import "_TBUtils.h"
+#import "_TBSceneResources.h"
 #import "UIView+Extensions.h"
 
-@implementation TBSimpleBar
+@implementation TBSimpleBar {
+
+    BOOL tbsmplbr_usesDefaultSeparatorImage;
+    BOOL tbsmplbr_needsUpdateLayout;
+
+    CGRect tbsmplbr_layoutBounds; // The bounds of the last layout pass
+    CGFloat tbsmplbr_layoutDisplayScale; // The display scale of the last layout pass
+}
 
 @synthesize contentView = _contentView;
 @synthesize separatorColor = tbsmplbr_separatorColor;
@@ -60,15 +68,42 @@
 
 #pragma mark Overrides
 
+- (void)didMoveToWindow {
+
+    [super didMoveToWindow];
+
+    if (self.window == nil || !tbsmplbr_usesDefaultSeparatorImage) {
+        return;
+    }
+
+    // The default image is rendered once per scene at the scale of its screen
+
+    UIImage *separatorImage = [_TBSceneResources resourcesForView:self].separatorImage;
+
+    if (tbsmplbr_separatorImage != separatorImage) {
+        tbsmplbr_separatorImage = separatorImage;
+        _separatorImageView.image = separatorImage;
+    }
+}
+
 - (void)layoutSubviews {
 
     [super layoutSubviews];
 
     CGRect const bounds = self.bounds;
+    CGFloat const displayScale = self.tb_displayScale;
+
+    if (!tbsmplbr_needsUpdateLayout && CGRectEqualToRect(bounds, tbsmplbr_layoutBounds) && displayScale == tbsmplbr_layoutDisplayScale) {
+        // Subclasses often lay out for reasons of their own, the separator and the content view are already in place
+        return;
+    }
+
+    tbsmplbr_needsUpdateLayout = false;
+    tbsmplbr_layoutBounds = bounds;
+    tbsmplbr_layoutDisplayScale = displayScale;
 
     CGFloat const width = CGRectGetWidth(bounds);
     CGFloat const height = CGRectGetHeight(bounds);
-    CGFloat const displayScale = self.tb_displayScale;
 
     // Separator
 
@@ -107,7 +142,7 @@
     UIView *contentView = self.contentView;
 
     if (contentView != nil && contentView.superview != nil) {
-        contentView.frame = self.bounds;
+        contentView.frame = bounds;
     }
 }
 
@@ -124,6 +159,8 @@
     _separatorImageView = [[UIImageView alloc] initWithImage:self.separatorImage];
     _separatorImageView.tintColor = self.separatorColor;
     _separatorImageView.autoresizingMask = UIViewAutoresizingNone;
+
+    tbsmplbr_needsUpdateLayout = true;
 }
 
 - (void)tbsmplbr_setup {
@@ -144,10 +181,19 @@
     }
 }
 
+#pragma mark Layout
+
+- (void)tbsmplbr_setNeedsUpdateLayout {
+
+    tbsmplbr_needsUpdateLayout = true;
+
+    [self setNeedsLayout];
+}
+
 #pragma mark Helpers
 
 - (UIImage *)makeSeparatorImage {
-    return _TBDrawFilledRectangleWithSize((CGSize){self.tb_displayScale, self.tb_displayScale});
+    return [_TBSceneResources resourcesForView:self].separatorImage;
 }
 
 #pragma mark Getters
@@ -169,6 +215,7 @@
 
     if (tbsmplbr_separatorImage == nil) {
         tbsmplbr_separatorImage = [self makeSeparatorImage];
+        tbsmplbr_usesDefaultSeparatorImage = true;
     }
 
     return tbsmplbr_separatorImage;
@@ -184,7 +231,7 @@
 
     _separatorSize = separatorSize;
 
-    [self setNeedsLayout];
+    [self tbsmplbr_setNeedsUpdateLayout];
 }
 
 - (void)setContentInsets:(UIEdgeInsets)contentInsets {
@@ -212,7 +259,7 @@
 
     _separatorPosition = separatorPosition;
 
-    [self setNeedsLayout];
+    [self tbsmplbr_setNeedsUpdateLayout];
 }
 
 - (void)setContentView:(UIView *)contentView {
@@ -224,6 +271,8 @@
     }
 
     _contentView = contentView;
+
+    [self tbsmplbr_setNeedsUpdateLayout];
 }
 
 - (void)setSeparatorImage:(UIImage *)separatorImage {
@@ -234,6 +283,8 @@
         tbsmplbr_separatorImage = [self makeSeparatorImage];
     }
 
+    tbsmplbr_usesDefaultSeparatorImage = (separatorImage == nil);
+
     _separatorImageView.image = tbsmplbr_separatorImage;
 
     [self setNeedsLayout];
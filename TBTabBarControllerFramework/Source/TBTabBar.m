@@ -26,13 +26,17 @@
 #import "TBTabBar.h"
 #import "TBTabBar+Private.h"
 #import "TBTabBarController.h"
+#import "TBTabBarAppearance.h"
 #import "TBTabBarItem.h"
 #import "TBTabBarButton.h"
+#import "TBTabBarButton+Private.h"
+#import "TBTabBarLayerButton.h"
 #import "UIView+Extensions.h"
 #import "TBTabBarItemsDifference.h"
 #import "TBTabBarItemChange.h"
 #import "_TBUtils.h"
 #import "_TBStackView.h"
+#import "_TBNotificationIndicatorAnimator.h"
 #import <objc/runtime.h>
 
 @interface TBTabBar()
@@ -40,15 +44,56 @@
 @property (strong, nonatomic) _TBStackView *stackView;
 @property (assign, nonatomic) TBTabBarControllerTabBarPlacement currentPlacement;
 
+- (BOOL)tbtbbr_items:(NSArray<TBTabBarItem *> *)items matchVisibleItemsCount:(NSUInteger)visibleItemsCount;
+
+- (void)tbtbbr_adoptVisibleItems:(NSArray<TBTabBarItem *> *)visibleItems hiddenItems:(NSArray<TBTabBarItem *> *)hiddenItems;
+
+- (__kindof TBTabBarButton *)tbtbbr_dequeueReusableButtonWithItem:(TBTabBarItem *)item;
+
+- (void)tbtbbr_enqueueReusableButton:(TBTabBarButton *)button;
+
+- (void)tbtbbr_animateInsertedButtons:(NSArray<TBTabBarButton *> *)insertedButtons removedButtons:(NSArray<TBTabBarButton *> *)removedButtons;
+
+- (CGFloat)tbtbbr_alphaOfButton:(TBTabBarButton *)button;
+
+- (CGRect)tbtbbr_displayedFrameOfButton:(TBTabBarButton *)button;
+
+- (void)tbtbbr_applyAppearanceToButton:(TBTabBarButton *)button;
+
+- (void)tbtbbr_cancelReordering;
+
+- (void)tbtbbr_didMoveItemAtIndex:(NSUInteger)sourceIndex toIndex:(NSUInteger)destinationIndex;
+
 @end
 
+static NSUInteger const _TBTabBarReusableButtonsLimit = 4;
+
+static NSTimeInterval const _TBTabBarItemChangesAnimationDuration = 0.25;
+
 @implementation TBTabBar {
 
     TBTabBarLayoutOrientation _layoutOrientation;
+
+    // Immutable copies of the visible and hidden items handed out by the getters, dropped whenever the items change
+    NSArray<__kindof TBTabBarItem *> *_visibleItemsSnapshot;
+    NSArray<__kindof TBTabBarItem *> *_hiddenItemsSnapshot;
+
+    NSMutableArray<TBTabBarButton *> *_reusableButtons; // Buttons of removed tabs, handed out again when tabs are inserted
+
+    CGSize _notificationIndicatorSize; // The size of the last appearance, zero until one is applied
+
+    NSUInteger _reorderingSourceIndex;
+    CGFloat _reorderingStartPosition; // The position of the touch along the axis when the drag began
+
+    TBMutableTabBarAppearance *_appliedAppearance; // The colors it leaves unset follow the tint color
+
+    BOOL _needsUpdateBadgeValues;
+    BOOL _overridesVisibleItemIndexes;
 }
 
 @synthesize defaultTintColor = _defaultTintColor;
 @synthesize notificationIndicatorTintColor = _notificationIndicatorTintColor;
+@synthesize reorderingGestureRecognizer = _reorderingGestureRecognizer;
 
 #pragma mark - Public
 
@@ -105,10 +150,10 @@
 
     BOOL isHidden = false;
 
-    NSUInteger itemIndexToSelect = [self.visibleItems indexOfObject:item];
+    NSUInteger itemIndexToSelect = [_visibleItems indexOfObject:item];
 
     if (itemIndexToSelect == NSNotFound) {
-        itemIndexToSelect = [self.hiddenItems indexOfObject:item];
+        itemIndexToSelect = [_hiddenItems indexOfObject:item];
         if (itemIndexToSelect == NSNotFound) {
             return;
         }
@@ -154,17 +199,42 @@
     return buttons[tabIndex];
 }
 
+- (void)applyAppearance:(TBTabBarAppearance *)appearance {
+
+    _appliedAppearance = [appearance mutableCopy];
+
+    _defaultTintColor = appearance.defaultTintColor;
+    _selectedTintColor = appearance.selectedTintColor ?: self.tintColor;
+    _notificationIndicatorTintColor = appearance.notificationIndicatorTintColor;
+
+    self.separatorColor = appearance.separatorColor;
+
+    if (CGSizeEqualToSize(appearance.notificationIndicatorSize, CGSizeZero) == false) {
+        _notificationIndicatorSize = appearance.notificationIndicatorSize;
+    }
+
+    [self tbtbbr_updateButtonsWithNotificationIndicatorSize:appearance.notificationIndicatorSize];
+
+    if (self.stackView.spacing != appearance.spaceBetweenTabs) {
+        self.spaceBetweenTabs = appearance.spaceBetweenTabs;
+    }
+}
+
 #pragma mark Overrides
 
 - (NSString *)description {
 
-    return [NSString stringWithFormat:@"%@, items count: %lu, visible items count: %lu, selected index: %lu, layout orientation: %@", [super description], _itemsCount, self.visibleItems.count, self.selectedIndex, (self.isVertical ? @"vertical" : @"horizontal")];
+    return [NSString stringWithFormat:@"%@, items count: %lu, visible items count: %lu, selected index: %lu, layout orientation: %@", [super description], _itemsCount, _visibleItems.count, self.selectedIndex, (self.isVertical ? @"vertical" : @"horizontal")];
 }
 
 - (void)layoutSubviews {
 
     [super layoutSubviews];
 
+    if (_needsUpdateBadgeValues) {
+        [self _updateBadgeValues];
+    }
+
     UIEdgeInsets const safeAreaInsets = self.safeAreaInsets;
     UIEdgeInsets const contentInsets = self.contentInsets;
     UIEdgeInsets const additionalContentInsets = _additionalContentInsets;
@@ -187,14 +257,37 @@
     }, displayScale, true);
 }
 
+- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event {
+
+    _TBStackView *stackView = self.stackView;
+
+    // Layer buttons have no subviews, so there is no need to walk down the view hierarchy to find the one being touched
+    if (self.isUserInteractionEnabled && self.isHidden == false && self.alpha > 0.01 && stackView.isHidden == false && [self pointInside:point withEvent:event]) {
+        CGPoint const stackViewPoint = [self convertPoint:point toView:stackView];
+        for (TBTabBarButton *button in stackView.subviews.reverseObjectEnumerator) {
+            if (CGRectContainsPoint(button.frame, stackViewPoint) == false) {
+                continue;
+            }
+            if ([button isKindOfClass:[TBTabBarLayerButton class]] && button.isUserInteractionEnabled && button.isHidden == false && button.alpha > 0.01) {
+                return button;
+            }
+            break;
+        }
+    }
+
+    return [super hitTest:point withEvent:event];
+}
+
 - (void)tintColorDidChange {
 
     [super tintColorDidChange];
 
     UIColor *const tintColor = self.tintColor;
 
-    self.selectedTintColor = tintColor;
-    self.notificationIndicatorTintColor = tintColor;
+    _selectedTintColor = _appliedAppearance.selectedTintColor ?: tintColor;
+    _notificationIndicatorTintColor = _appliedAppearance.notificationIndicatorTintColor ?: tintColor;
+
+    [self tbtbbr_updateButtonsWithNotificationIndicatorSize:CGSizeZero];
 }
 
 #pragma mark Private Methods
@@ -210,6 +303,9 @@
     _shouldSelectItem = true;
     _maxNumberOfVisibleTabs = 5;
     _vertical = (_layoutOrientation == TBTabBarLayoutOrientationVertical);
+    _overridesVisibleItemIndexes = _TBSubclassOverridesMethod([TBTabBar class], [self class], @selector(visibleItemIndexes));
+    _animatesItemChanges = true;
+    _reusableButtons = [NSMutableArray array];
 
     self.separatorPosition = _vertical ?
         TBSimpleBarSeparatorPositionRight :
@@ -232,6 +328,214 @@
     [self addSubview:self.stackView];
 }
 
+#pragma mark Item changes
+
+- (__kindof TBTabBarButton *)tbtbbr_dequeueReusableButtonWithItem:(TBTabBarItem *)item {
+
+    for (NSUInteger index = _reusableButtons.count; index > 0; index -= 1) {
+        TBTabBarButton *button = _reusableButtons[index - 1];
+        if ([button class] != item.buttonClass) {
+            continue;
+        }
+        [_reusableButtons removeObjectAtIndex:index - 1];
+        [button _setTabBarItem:item];
+        // The appearance may have changed while the button was in the pool, where appearance updates do not reach
+        [self tbtbbr_applyAppearanceToButton:button];
+        return button;
+    }
+
+    return [self _makeButtonWithItem:item];
+}
+
+- (void)tbtbbr_enqueueReusableButton:(TBTabBarButton *)button {
+
+    if (_reusableButtons.count >= _TBTabBarReusableButtonsLimit) {
+        return;
+    }
+
+    [[_TBNotificationIndicatorAnimator sharedAnimator] cancelNotificationIndicatorTransitionForButton:button];
+
+    // The alpha reflects the enabled state, which setEnabled: does not reapply when the next item has the same one
+    button.alpha = [self tbtbbr_alphaOfButton:button];
+    button.selected = false;
+    button.highlighted = false;
+
+    [_reusableButtons addObject:button];
+}
+
+- (void)tbtbbr_animateInsertedButtons:(NSArray<TBTabBarButton *> *)insertedButtons removedButtons:(NSArray<TBTabBarButton *> *)removedButtons {
+
+    _TBStackView *stackView = self.stackView;
+    NSArray<TBTabBarButton *> *buttons = stackView.subviews;
+    NSUInteger const buttonsCount = buttons.count;
+
+    // Buttons that stay start sliding from where they are on screen, which differs from their frames when a previous change is still animating
+
+    NSMutableData *framesData = [NSMutableData dataWithLength:buttonsCount * sizeof(CGRect)];
+    CGRect *frames = (CGRect *)framesData.mutableBytes;
+
+    for (NSUInteger index = 0; index < buttonsCount; index += 1) {
+        frames[index] = [self tbtbbr_displayedFrameOfButton:buttons[index]];
+    }
+
+    // Removed buttons fade out above the stack view, which lays out its own subviews only
+
+    for (TBTabBarButton *button in removedButtons) {
+        CGRect const frame = [stackView convertRect:[self tbtbbr_displayedFrameOfButton:button] toView:self];
+        [self addSubview:button];
+        button.frame = frame;
+    }
+
+    // The stack view computes the final frames once, then the buttons that stay are put back and animated there
+
+    [stackView setNeedsLayout];
+
+    [UIView performWithoutAnimation:^{
+        [stackView layoutIfNeeded];
+        for (NSUInteger index = 0; index < buttonsCount; index += 1) {
+            TBTabBarButton *button = buttons[index];
+            if ([insertedButtons indexOfObjectIdenticalTo:button] != NSNotFound) {
+                button.alpha = 0.0;
+                continue;
+            }
+            CGRect const frame = button.frame;
+            button.frame = frames[index];
+            frames[index] = frame;
+        }
+    }];
+
+    [UIView animateWithDuration:_TBTabBarItemChangesAnimationDuration delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState | UIViewAnimationOptionAllowUserInteraction animations:^{
+        for (NSUInteger index = 0; index < buttonsCount; index += 1) {
+            TBTabBarButton *button = buttons[index];
+            if ([insertedButtons indexOfObjectIdenticalTo:button] != NSNotFound) {
+                button.alpha = [self tbtbbr_alphaOfButton:button];
+            } else {
+                button.frame = frames[index];
+            }
+        }
+        for (TBTabBarButton *button in removedButtons) {
+            button.alpha = 0.0;
+        }
+        (void)framesData; // Keeps the frames alive for as long as the block
+    } completion:^(BOOL finished) {
+        // The buttons are pooled only now, so none of them is reused while it is still on screen
+        for (TBTabBarButton *button in removedButtons) {
+            [button removeFromSuperview];
+            [self tbtbbr_enqueueReusableButton:button];
+        }
+    }];
+}
+
+#pragma mark Helpers
+
+- (CGFloat)tbtbbr_alphaOfButton:(TBTabBarButton *)button {
+
+    return button.isEnabled ? 1.0 : 0.5;
+}
+
+- (CGRect)tbtbbr_displayedFrameOfButton:(TBTabBarButton *)button {
+
+    CALayer *presentationLayer = button.layer.presentationLayer;
+
+    return presentationLayer != nil ? presentationLayer.frame : button.frame;
+}
+
+- (void)tbtbbr_applyAppearanceToButton:(TBTabBarButton *)button {
+
+    [button _setNotificationIndicatorTintColor:self.notificationIndicatorTintColor];
+
+    button.tintColor = self.defaultTintColor;
+
+    if (CGSizeEqualToSize(_notificationIndicatorSize, CGSizeZero) == false &&
+        CGSizeEqualToSize(button.notificationIndicatorSize, _notificationIndicatorSize) == false) {
+        button.notificationIndicatorSize = _notificationIndicatorSize;
+    }
+}
+
+- (BOOL)tbtbbr_items:(NSArray<TBTabBarItem *> *)items matchVisibleItemsCount:(NSUInteger)visibleItemsCount {
+
+    // Compares identities in place, so an update that changes nothing allocates nothing
+
+    if (_visibleItems.count != visibleItemsCount || _hiddenItems.count != _itemsCount - visibleItemsCount) {
+        return false;
+    }
+
+    for (NSUInteger index = 0; index < visibleItemsCount; index += 1) {
+        if (items[index] != _visibleItems[index]) {
+            return false;
+        }
+    }
+
+    for (NSUInteger index = visibleItemsCount; index < _itemsCount; index += 1) {
+        if (items[index] != _hiddenItems[index - visibleItemsCount]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+- (void)tbtbbr_adoptVisibleItems:(NSArray<TBTabBarItem *> *)visibleItems hiddenItems:(NSArray<TBTabBarItem *> *)hiddenItems {
+
+    // After the differences are applied, the tabs that stayed may still hold the previous items with the same identifiers
+
+    NSUInteger const visibleItemsCount = visibleItems.count;
+
+    if (_visibleItems.count == visibleItemsCount) {
+        NSArray<TBTabBarButton *> *buttons;
+        for (NSUInteger index = 0; index < visibleItemsCount; index += 1) {
+            TBTabBarItem *item = visibleItems[index];
+            if (_visibleItems[index] == item) {
+                continue;
+            }
+            if (buttons == nil) {
+                buttons = self.stackView.subviews;
+            }
+            [_visibleItems replaceObjectAtIndex:index withObject:item];
+            [buttons[index] _setTabBarItem:item];
+            _visibleItemsSnapshot = nil;
+        }
+    }
+
+    NSUInteger const hiddenItemsCount = hiddenItems.count;
+
+    if (_hiddenItems.count == hiddenItemsCount) {
+        for (NSUInteger index = 0; index < hiddenItemsCount; index += 1) {
+            TBTabBarItem *item = hiddenItems[index];
+            if (_hiddenItems[index] != item) {
+                [_hiddenItems replaceObjectAtIndex:index withObject:item];
+                _hiddenItemsSnapshot = nil;
+            }
+        }
+    }
+}
+
+- (void)tbtbbr_updateButtonsWithNotificationIndicatorSize:(CGSize)notificationIndicatorSize {
+
+    // Updates every button in a single pass. A zero size keeps the current size of the notification indicators.
+
+    UIColor *defaultTintColor = self.defaultTintColor;
+    UIColor *selectedTintColor = self.selectedTintColor;
+    UIColor *notificationIndicatorTintColor = self.notificationIndicatorTintColor;
+
+    BOOL const shouldUpdateNotificationIndicatorSize = CGSizeEqualToSize(notificationIndicatorSize, CGSizeZero) == false;
+
+    NSUInteger const selectedIndex = self.selectedIndex;
+
+    [self.stackView.subviews enumerateObjectsUsingBlock:^(TBTabBarButton *button, NSUInteger index, BOOL *stop) {
+        UIColor *tintColor = (index == selectedIndex) ? selectedTintColor : defaultTintColor;
+        // Setting the same tint color triggers the whole `tintColorDidChange` cascade anyway
+        if ([button.tintColor isEqual:tintColor] == false) {
+            button.tintColor = tintColor;
+        }
+        [button _setNotificationIndicatorTintColor:notificationIndicatorTintColor];
+        // The button invalidates its layout on its own, but only when the size differs
+        if (shouldUpdateNotificationIndicatorSize && CGSizeEqualToSize(button.notificationIndicatorSize, notificationIndicatorSize) == false) {
+            button.notificationIndicatorSize = notificationIndicatorSize;
+        }
+    }];
+}
+
 #pragma mark Actions
 
 - (void)tbtbbr_willSelectButton:(TBTabBarButton *)button {
@@ -254,16 +558,127 @@
     _shouldSelectItem = true;
 }
 
+#pragma mark Gestures
+
+- (BOOL)gestureRecognizerShouldBegin:(UIGestureRecognizer *)gestureRecognizer {
+
+    if (gestureRecognizer != _reorderingGestureRecognizer) {
+        return [super gestureRecognizerShouldBegin:gestureRecognizer];
+    }
+
+    if (_visibleItems.count < 2) {
+        return false;
+    }
+
+    CGPoint const location = [gestureRecognizer locationInView:self.stackView];
+
+    return [self.stackView.subviews indexOfObjectPassingTest:^BOOL(TBTabBarButton * _Nonnull button, NSUInteger index, BOOL * _Nonnull stop) {
+        return CGRectContainsPoint(button.frame, location);
+    }] != NSNotFound;
+}
+
+- (void)tbtbbr_handleReorderingGestureRecognizer:(UILongPressGestureRecognizer *)gestureRecognizer {
+
+    _TBStackView *stackView = self.stackView;
+
+    CGPoint const location = [gestureRecognizer locationInView:stackView];
+    CGFloat const position = _vertical ? location.y : location.x;
+
+    switch (gestureRecognizer.state) {
+        case UIGestureRecognizerStateBegan: {
+            NSUInteger const index = [stackView.subviews indexOfObjectPassingTest:^BOOL(TBTabBarButton * _Nonnull button, NSUInteger index, BOOL * _Nonnull stop) {
+                return CGRectContainsPoint(button.frame, location);
+            }];
+            if (index == NSNotFound) {
+                [self tbtbbr_cancelReordering];
+                return;
+            }
+            _reorderingSourceIndex = index;
+            _reorderingStartPosition = position;
+            [stackView beginReorderingSubviewAtIndex:index];
+            break;
+        }
+        case UIGestureRecognizerStateChanged:
+            // Every touch update reuses the cached frames, nothing is laid out or allocated until the drag passes over a neighbour
+            [stackView updateReorderingWithTranslation:position - _reorderingStartPosition];
+            break;
+        case UIGestureRecognizerStateEnded: {
+            NSUInteger const destinationIndex = [stackView endReordering];
+            if (destinationIndex != NSNotFound && destinationIndex != _reorderingSourceIndex) {
+                [self tbtbbr_didMoveItemAtIndex:_reorderingSourceIndex toIndex:destinationIndex];
+            }
+            break;
+        }
+        case UIGestureRecognizerStateCancelled:
+        case UIGestureRecognizerStateFailed:
+            [stackView cancelReordering];
+            break;
+        default:
+            break;
+    }
+}
+
+- (void)tbtbbr_cancelReordering {
+
+    [self.stackView cancelReordering];
+
+    // Toggling the recognizer cancels the touches it is tracking
+    if (_reorderingGestureRecognizer.isEnabled) {
+        _reorderingGestureRecognizer.enabled = false;
+        _reorderingGestureRecognizer.enabled = true;
+    }
+}
+
+- (void)tbtbbr_didMoveItemAtIndex:(NSUInteger)sourceIndex toIndex:(NSUInteger)destinationIndex {
+
+    TBTabBarItem *item = _visibleItems[sourceIndex];
+    TBTabBarItem *selectedItem = _selectedIndex < _visibleItems.count ? _visibleItems[_selectedIndex] : nil;
+
+    // The buttons are already in place, so the items follow them without a difference being applied
+
+    [_visibleItems removeObjectAtIndex:sourceIndex];
+    [_visibleItems insertObject:item atIndex:destinationIndex];
+
+    _visibleItemsSnapshot = nil;
+
+    if (selectedItem != nil) {
+        _selectedIndex = [_visibleItems indexOfObjectIdenticalTo:selectedItem];
+    }
+
+    if (_delegateFlags.didMoveItem) {
+        [self.delegate tabBar:self didMoveItem:item fromIndex:sourceIndex toIndex:destinationIndex];
+    }
+}
+
 #pragma mark Getters
 
 - (NSArray<__kindof TBTabBarItem *> *)visibleItems {
 
-    return [_visibleItems copy];
+    if (_visibleItemsSnapshot == nil) {
+        _visibleItemsSnapshot = [_visibleItems copy];
+    }
+
+    return _visibleItemsSnapshot;
 }
 
 - (NSArray<__kindof TBTabBarItem *> *)hiddenItems {
 
-    return [_hiddenItems copy];
+    if (_hiddenItemsSnapshot == nil) {
+        _hiddenItemsSnapshot = [_hiddenItems copy];
+    }
+
+    return _hiddenItemsSnapshot;
+}
+
+- (UILongPressGestureRecognizer *)reorderingGestureRecognizer {
+
+    if (_reorderingGestureRecognizer == nil) {
+        _reorderingGestureRecognizer = [[UILongPressGestureRecognizer alloc] initWithTarget:self action:@selector(tbtbbr_handleReorderingGestureRecognizer:)];
+        _reorderingGestureRecognizer.delegate = self;
+        _reorderingGestureRecognizer.enabled = _allowsItemReordering;
+    }
+
+    return _reorderingGestureRecognizer;
 }
 
 - (_TBStackView *)stackView {
@@ -299,6 +714,24 @@
     return self.stackView.spacing;
 }
 
+- (TBTabBarAppearance *)currentAppearance {
+
+    TBMutableTabBarAppearance *appearance = [[TBMutableTabBarAppearance alloc] init];
+    appearance.defaultTintColor = self.defaultTintColor;
+    appearance.selectedTintColor = self.selectedTintColor;
+    appearance.notificationIndicatorTintColor = self.notificationIndicatorTintColor;
+    appearance.separatorColor = self.separatorColor;
+    appearance.spaceBetweenTabs = self.spaceBetweenTabs;
+
+    TBTabBarButton *button = self.stackView.subviews.firstObject;
+
+    if (button != nil) {
+        appearance.notificationIndicatorSize = button.notificationIndicatorSize;
+    }
+
+    return [appearance copy];
+}
+
 #pragma mark Setters
 
 - (void)setItems:(NSArray <TBTabBarItem *> *)items {
@@ -325,6 +758,8 @@
 
 - (void)setSelectedTintColor:(UIColor *)selectedTintColor {
 
+    _appliedAppearance.selectedTintColor = selectedTintColor;
+
     if (selectedTintColor != nil) {
         _selectedTintColor = selectedTintColor;
     } else {
@@ -342,6 +777,8 @@
 
 - (void)setNotificationIndicatorTintColor:(UIColor *)notificationIndicatorTintColor {
 
+    _appliedAppearance.notificationIndicatorTintColor = notificationIndicatorTintColor;
+
     if (notificationIndicatorTintColor != nil) {
         _notificationIndicatorTintColor = notificationIndicatorTintColor;
     } else {
@@ -349,26 +786,26 @@
     }
 
     for (TBTabBarButton *button in self.stackView.subviews) {
-        button.notificationIndicatorView.tintColor = _notificationIndicatorTintColor;
+        [button _setNotificationIndicatorTintColor:_notificationIndicatorTintColor];
     }
 }
 
 - (void)setSelectedIndex:(NSUInteger)selectedIndex {
 
-    if (self.visibleItems.count == 0) {
+    if (_visibleItems.count == 0) {
         return [self _deselect];
     }
 
     NSUInteger const index = MIN(MAX(0, _itemsCount - 1), selectedIndex);
 
-    __kindof TBTabBarItem *itemToSelect = self.visibleItems[index];
+    __kindof TBTabBarItem *itemToSelect = _visibleItems[index];
 
     if (_delegateFlags.shouldSelectItemAtIndex && ![self.delegate tabBar:self shouldSelectItem:itemToSelect atIndex:index]) {
         return;
     }
 
     if (_delegateFlags.didSelectItemAtIndex) {
-        [self.delegate tabBar:self didSelectItem:self.visibleItems[index] atIndex:index];
+        [self.delegate tabBar:self didSelectItem:itemToSelect atIndex:index];
     }
 }
 
@@ -396,6 +833,23 @@
 
     _delegateFlags.shouldSelectItemAtIndex = [delegate respondsToSelector:@selector(tabBar:shouldSelectItem:atIndex:)];
     _delegateFlags.didSelectItemAtIndex = [delegate respondsToSelector:@selector(tabBar:didSelectItem:atIndex:)];
+    _delegateFlags.didMoveItem = [delegate respondsToSelector:@selector(tabBar:didMoveItem:fromIndex:toIndex:)];
+}
+
+- (void)setAllowsItemReordering:(BOOL)allowsItemReordering {
+
+    if (_allowsItemReordering == allowsItemReordering) {
+        return;
+    }
+
+    _allowsItemReordering = allowsItemReordering;
+
+    if (allowsItemReordering && self.reorderingGestureRecognizer.view == nil) {
+        [self.stackView addGestureRecognizer:self.reorderingGestureRecognizer];
+    }
+
+    // Disabling the recognizer cancels a drag in progress
+    _reorderingGestureRecognizer.enabled = allowsItemReordering;
 }
 
 @end
@@ -406,25 +860,35 @@
 
 - (void)updateItems {
 
-    NSIndexSet *const visibleItemIndexes = [self visibleItemIndexes];
-
-    NSAssert(visibleItemIndexes != nil, @"Visible item indexes of `%@` must not be nil", [self class]);
-
     NSArray<TBTabBarItem *> *items = self.items;
 
     if (items != nil && items.count > 0) {
-        // Visible items
-        NSArray *const newVisibleItems = [items objectsAtIndexes:visibleItemIndexes];
-        TBTabBarItemsDifference *const visibleItemsDifference = [TBTabBarItemsDifference differenceWithItems:newVisibleItems from:_visibleItems];
-        // Hidden items
-        NSMutableIndexSet *const hiddenItemIndexes = [[NSMutableIndexSet alloc] initWithIndexesInRange:NSMakeRange(0, _itemsCount)];
-        [hiddenItemIndexes removeIndexes:visibleItemIndexes];
-        NSArray *const newHiddenItems = [items objectsAtIndexes:hiddenItemIndexes];
-        TBTabBarItemsDifference *const hiddenItemsDifference = [TBTabBarItemsDifference differenceWithItems:newHiddenItems from:_hiddenItems];
-        // Apply differences
-        [self applyVisibleItemsDifference:visibleItemsDifference];
-        [self applyHiddenItemsDifference:hiddenItemsDifference];
+        NSArray *newVisibleItems, *newHiddenItems;
+        if (_overridesVisibleItemIndexes) {
+            NSIndexSet *const visibleItemIndexes = [self visibleItemIndexes];
+            NSAssert(visibleItemIndexes != nil, @"Visible item indexes of `%@` must not be nil", [self class]);
+            NSMutableIndexSet *const hiddenItemIndexes = [[NSMutableIndexSet alloc] initWithIndexesInRange:NSMakeRange(0, _itemsCount)];
+            [hiddenItemIndexes removeIndexes:visibleItemIndexes];
+            newVisibleItems = [items objectsAtIndexes:visibleItemIndexes];
+            newHiddenItems = [items objectsAtIndexes:hiddenItemIndexes];
+        } else {
+            // The default visible items are a prefix of the items, so nothing is allocated when they stay the same
+            NSUInteger const maxNumberOfVisibleTabs = self.maxNumberOfVisibleTabs;
+            NSUInteger const visibleItemsCount = maxNumberOfVisibleTabs == 0 ? _itemsCount : MIN(_itemsCount, maxNumberOfVisibleTabs);
+            if ([self tbtbbr_items:items matchVisibleItemsCount:visibleItemsCount]) {
+                return;
+            }
+            newVisibleItems = [items subarrayWithRange:NSMakeRange(0, visibleItemsCount)];
+            newHiddenItems = [items subarrayWithRange:NSMakeRange(visibleItemsCount, _itemsCount - visibleItemsCount)];
+        }
+        // Apply differences. Items are compared by identifiers, so a tab whose item is replaced keeps its button
+        [self applyVisibleItemsDifference:[TBTabBarItemsDifference differenceByIdentifyingItems:newVisibleItems from:_visibleItems]];
+        [self applyHiddenItemsDifference:[TBTabBarItemsDifference differenceByIdentifyingItems:newHiddenItems from:_hiddenItems]];
+        [self tbtbbr_adoptVisibleItems:newVisibleItems hiddenItems:newHiddenItems];
     } else {
+        if (_visibleItems.count == 0 && _hiddenItems.count == 0) {
+            return;
+        }
         // Visible items
         NSMutableArray<TBTabBarItemChange *> *visibleItemsChanges = [NSMutableArray array];
         [_visibleItems enumerateObjectsWithOptions:NSEnumerationReverse usingBlock:^(__kindof TBTabBarItem * _Nonnull item, NSUInteger index, BOOL * _Nonnull stop) {
@@ -448,9 +912,18 @@
     }
 
     _TBStackView *stackView = self.stackView;
+
+    if (stackView.isReordering) {
+        // The dragged tab may be gone, so the drag ends here
+        [self tbtbbr_cancelReordering];
+    }
+
     NSArray<TBTabBarButton *> *buttons = stackView.subviews;
 
+    BOOL const animated = _animatesItemChanges && self.isVisible && self.window != nil && [UIView areAnimationsEnabled];
+
     NSMutableArray<TBTabBarButton *> *removedButtons = [NSMutableArray array];
+    NSMutableArray<TBTabBarButton *> *insertedButtons = animated ? [NSMutableArray array] : nil;
 
     for (TBTabBarItemChange *change in difference) {
         if (change.type == TBTabBarItemChangeRemove) {
@@ -461,28 +934,41 @@
         } else {
             TBTabBarButton *buttonToInsert;
             if (removedButtons.count > 0) {
+                NSString *itemIdentifier = change.item.itemIdentifier;
                 NSUInteger const removedButtonIndex = [removedButtons indexOfObjectPassingTest:^BOOL(TBTabBarButton * _Nonnull button, NSUInteger index, BOOL * _Nonnull stop) {
-                    if ([button.tabBarItem isEqual:change.item]) {
+                    if ([button.tabBarItem.itemIdentifier isEqualToString:itemIdentifier]) {
                         *stop = true;
                         return true;
                     }
                     return false;
                 }];
                 if (removedButtonIndex != NSNotFound) {
+                    // The tab has moved
                     buttonToInsert = removedButtons[removedButtonIndex];
+                    [buttonToInsert _setTabBarItem:change.item];
                     [removedButtons removeObjectAtIndex:removedButtonIndex];
-                } else {
-                    buttonToInsert = [self _makeButtonWithItem:change.item];
                 }
-            } else {
-                buttonToInsert = [self _makeButtonWithItem:change.item];
+            }
+            if (buttonToInsert == nil) {
+                buttonToInsert = [self tbtbbr_dequeueReusableButtonWithItem:change.item];
+                [insertedButtons addObject:buttonToInsert];
             }
             [stackView insertSubview:buttonToInsert atIndex:change.index];
             [_visibleItems insertObject:change.item atIndex:change.index];
         }
     }
 
-    [stackView setNeedsLayout];
+    _visibleItemsSnapshot = nil;
+
+    if (animated) {
+        [self tbtbbr_animateInsertedButtons:insertedButtons removedButtons:removedButtons];
+    } else {
+        for (TBTabBarButton *button in removedButtons) {
+            [self tbtbbr_enqueueReusableButton:button];
+        }
+        [stackView setNeedsLayout];
+    }
+
     [self setNeedsLayout];
 }
 
@@ -502,6 +988,8 @@
                 break;
         }
     }
+
+    _hiddenItemsSnapshot = nil;
 }
 
 - (NSIndexSet *)visibleItemIndexes {
@@ -536,10 +1024,9 @@
     [self updateItems];
 
     if (shouldNotifyDelegate && _delegateFlags.didSelectItemAtIndex) {
-        NSArray *visibleItems = self.visibleItems;
-        if (visibleItems.count > 0) {
+        if (_visibleItems.count > 0) {
             NSUInteger const selectedIndex = self.selectedIndex;
-            [self.delegate tabBar:self didSelectItem:visibleItems[selectedIndex] atIndex:selectedIndex];
+            [self.delegate tabBar:self didSelectItem:_visibleItems[selectedIndex] atIndex:selectedIndex];
         }
     }
 }
@@ -548,7 +1035,7 @@
 
     NSUInteger const index = MIN(MAX(0, _itemsCount - 1), selectedIndex);
 
-    __kindof TBTabBarItem *itemToSelect = self.visibleItems[index];
+    __kindof TBTabBarItem *itemToSelect = _visibleItems[index];
 
     if (quietly == false && _delegateFlags.shouldSelectItemAtIndex && ![self.delegate tabBar:self shouldSelectItem:itemToSelect atIndex:index]) {
         return;
@@ -569,7 +1056,7 @@
     buttonToSelect.tintColor = self.selectedTintColor;
 
     if (quietly == false && _delegateFlags.didSelectItemAtIndex) {
-        [self.delegate tabBar:self didSelectItem:self.visibleItems[index] atIndex:index];
+        [self.delegate tabBar:self didSelectItem:itemToSelect atIndex:index];
     }
 }
 
@@ -603,8 +1090,7 @@
         TBTabBarButtonLayoutOrientationVertical;
 
     TBTabBarButton *button = [[item.buttonClass alloc] initWithTabBarItem:item layoutOrientation: orientation];
-    button.notificationIndicatorView.tintColor = self.notificationIndicatorTintColor;
-    button.tintColor = self.defaultTintColor;
+    [self tbtbbr_applyAppearanceToButton:button];
     button.autoresizingMask = UIViewAutoresizingNone;
 
     [button addTarget:self
@@ -644,7 +1130,7 @@
 
     NSArray<TBTabBarButton *> *buttons = self.stackView.subviews;
 
-    ((UIImageView *)buttons[index].notificationIndicatorView).image = image;
+    [buttons[index] _setNotificationIndicatorImage:image];
 }
 
 - (void)_setNotificationIndicatorHidden:(BOOL)hidden forButtonAtIndex:(NSUInteger)index {
@@ -658,6 +1144,32 @@
     [buttons[index] setNotificationIndicatorHidden:hidden animated:self.isVisible];
 }
 
+- (void)_setBadgeValue:(NSString *)badgeValue forButtonAtIndex:(NSUInteger)index {
+
+    NSArray<TBTabBarButton *> *buttons = self.stackView.subviews;
+
+    if (buttons.count <= index) {
+        return;
+    }
+
+    [buttons[index] _setBadgeValue:badgeValue];
+}
+
+- (void)_updateBadgeValues {
+
+    _needsUpdateBadgeValues = false;
+
+    // Buttons ignore values that have not changed, so only the updated badges are re-rendered
+    for (TBTabBarButton *button in self.stackView.subviews) {
+        [button _setBadgeValue:button.tabBarItem.badgeValue];
+    }
+}
+
+- (void)_setNeedsUpdateBadgeValues {
+
+    _needsUpdateBadgeValues = true;
+}
+
 - (void)_setAdditionalContentInsets:(UIEdgeInsets)additionalContentInsets {
 
     if (UIEdgeInsetsEqualToEdgeInsets(_additionalContentInsets, additionalContentInsets)) {
@@ -672,6 +1184,10 @@
 - (void)_setVisible:(BOOL)visible {
 
     _visible = visible;
+
+    if (visible && _needsUpdateBadgeValues) {
+        [self _updateBadgeValues];
+    }
 }
 
 - (void)_prepareForTransitionToPlacement:(TBTabBarControllerTabBarPlacement)preferredTabBarPlacement {
@@ -0,0 +1,165 @@
+//
+//  TBTabBarAppearance.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarAppearance.h"
+#import "_TBUtils.h"
+
+static CGFloat const _TBTabBarAppearanceDefaultSpaceBetweenTabs = 4.0;
+static CGFloat const _TBTabBarAppearanceDefaultNotificationIndicatorSize = 5.0;
+
+static inline BOOL _TBTabBarAppearanceColorsEqual(UIColor *lhs, UIColor *rhs) {
+
+    return lhs == rhs || [lhs isEqual:rhs];
+}
+
+@interface TBTabBarAppearance ()
+
+@property (strong, nonatomic, readwrite, nullable) UIColor *defaultTintColor;
+@property (strong, nonatomic, readwrite, nullable) UIColor *selectedTintColor;
+@property (strong, nonatomic, readwrite, nullable) UIColor *notificationIndicatorTintColor;
+@property (strong, nonatomic, readwrite, nullable) UIColor *separatorColor;
+@property (assign, nonatomic, readwrite) CGFloat spaceBetweenTabs;
+@property (assign, nonatomic, readwrite) CGSize notificationIndicatorSize;
+
+@end
+
+@implementation TBTabBarAppearance
+
+#pragma mark - Public
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+
+    self = [super init];
+
+    if (self) {
+        _spaceBetweenTabs = _TBTabBarAppearanceDefaultSpaceBetweenTabs;
+        _notificationIndicatorSize = (CGSize){_TBTabBarAppearanceDefaultNotificationIndicatorSize, _TBTabBarAppearanceDefaultNotificationIndicatorSize};
+    }
+
+    return self;
+}
+
++ (instancetype)defaultAppearance {
+
+    return [[self alloc] init];
+}
+
+#pragma mark Interface
+
+- (BOOL)isEqualToAppearance:(TBTabBarAppearance *)appearance {
+
+    return _TBTabBarAppearanceColorsEqual(self.defaultTintColor, appearance.defaultTintColor) &&
+        _TBTabBarAppearanceColorsEqual(self.selectedTintColor, appearance.selectedTintColor) &&
+        _TBTabBarAppearanceColorsEqual(self.notificationIndicatorTintColor, appearance.notificationIndicatorTintColor) &&
+        _TBTabBarAppearanceColorsEqual(self.separatorColor, appearance.separatorColor) &&
+        self.spaceBetweenTabs == appearance.spaceBetweenTabs &&
+        CGSizeEqualToSize(self.notificationIndicatorSize, appearance.notificationIndicatorSize);
+}
+
+#pragma mark Overrides
+
+- (NSUInteger)hash {
+
+    return self.defaultTintColor.hash ^
+        TB_UINT_ROTATE(self.selectedTintColor.hash, TB_UINT_BIT / 4) ^
+        TB_UINT_ROTATE(self.notificationIndicatorTintColor.hash, TB_UINT_BIT / 2) ^
+        TB_UINT_ROTATE(self.separatorColor.hash, TB_UINT_BIT / 4 * 3) ^
+        (NSUInteger)self.spaceBetweenTabs;
+}
+
+- (NSString *)description {
+
+    return [NSString stringWithFormat:@"%@, default tint color: %@, selected tint color: %@, notification indicator tint color: %@, separator color: %@, space between tabs: %.1f, notification indicator size: %@", [super description], self.defaultTintColor, self.selectedTintColor, self.notificationIndicatorTintColor, self.separatorColor, self.spaceBetweenTabs, NSStringFromCGSize(self.notificationIndicatorSize)];
+}
+
+#pragma mark NSObject
+
+- (BOOL)isEqual:(id)object {
+
+    if (self == object) {
+        return true;
+    }
+
+    if ([object isKindOfClass:[TBTabBarAppearance class]] == false) {
+        return false;
+    }
+
+    return [self isEqualToAppearance:object];
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+
+    if ([self isMemberOfClass:[TBTabBarAppearance class]]) {
+        // Immutable, so there is nothing to copy
+        return self;
+    }
+
+    return [self tbtbbrppr_copyOfClass:[TBTabBarAppearance class] zone:zone];
+}
+
+#pragma mark - NSMutableCopying
+
+- (id)mutableCopyWithZone:(NSZone *)zone {
+
+    return [self tbtbbrppr_copyOfClass:[TBMutableTabBarAppearance class] zone:zone];
+}
+
+#pragma mark Private Methods
+
+#pragma mark Helpers
+
+- (TBTabBarAppearance *)tbtbbrppr_copyOfClass:(Class)class zone:(NSZone *)zone {
+
+    TBTabBarAppearance *copy = [[class allocWithZone:zone] init];
+
+    if (copy != nil) {
+        copy->_defaultTintColor = _defaultTintColor;
+        copy->_selectedTintColor = _selectedTintColor;
+        copy->_notificationIndicatorTintColor = _notificationIndicatorTintColor;
+        copy->_separatorColor = _separatorColor;
+        copy->_spaceBetweenTabs = _spaceBetweenTabs;
+        copy->_notificationIndicatorSize = _notificationIndicatorSize;
+    }
+
+    return copy;
+}
+
+@end
+
+#pragma mark - Mutable appearance
+
+@implementation TBMutableTabBarAppearance
+
+@dynamic defaultTintColor;
+@dynamic selectedTintColor;
+@dynamic notificationIndicatorTintColor;
+@dynamic separatorColor;
+@dynamic spaceBetweenTabs;
+@dynamic notificationIndicatorSize;
+
+@end
@@ -23,13 +23,17 @@
 //  SOFTWARE.
 
 #import "TBTabBarButton.h"
+#import "TBTabBarButton+Private.h"
 #import "TBTabBarItem.h"
+#import "_TBNotificationIndicatorAnimator.h"
+#import "_TBBadgeRenderer.h"
 #import "_TBUtils.h"
 #import "UIView+Extensions.h"
 
 static const CGFloat _TBTabBarButtonNotificationIndicatorSize = 5.0;
 static const CGFloat _TBTabBarButtonNotificationIndicatorPresentationAnimationDuration = 0.25;
 static const CGFloat _TBTabBarButtonNotificationIndicatorDismissalAnimationDuration = 0.25;
+static const CGFloat _TBTabBarButtonBadgeFontSize = 11.0;
 
 static NSString *const _TBTabBarButtonNotificationIndicatorAnimationKey = @"_TBTabBarButtonNotificationIndicatorAnimationKey";
 
@@ -57,10 +61,16 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
     UIImage *_disabledImage;
     UIImage *_selectedImage;
     UIImage *_highlightedAndSelectedImage;
+
+    CALayer *_badgeLayer;
+    UIImage *_badgeImage;
 }
 
 @synthesize imageView = _imageView;
 @synthesize notificationIndicatorView = _notificationIndicatorView;
+@synthesize badgeFont = _badgeFont;
+@synthesize badgeTextColor = _badgeTextColor;
+@synthesize badgeColor = _badgeColor;
 
 #pragma mark Lifecycle
 
@@ -104,67 +114,23 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
 
 - (void)setNotificationIndicatorHidden:(BOOL)hidden animated:(BOOL)animated {
 
-    BOOL const isNotificationIndicatorVisible = !hidden;
-
-    UIView *notificationIndicatorView = self.notificationIndicatorView;
+    _TBNotificationIndicatorAnimator *animator = [_TBNotificationIndicatorAnimator sharedAnimator];
 
-    if (isNotificationIndicatorVisible) {
-        if (notificationIndicatorView.superview == nil) {
-            [self addSubview:notificationIndicatorView];
-        }
-        // We need to layout the notification indicator view before animation otherwise it will be glitchy
-        // There is no reason to layout whole button when the indicator is hidden before the update
-        [self _setNeedsLayout];
-        [self layoutIfNeeded];
+    if (animated && self.window != nil) {
+        // Transitions are coalesced and flushed once per frame
+        [animator setNotificationIndicatorHidden:hidden forButton:self];
+        return;
     }
 
-    _notificationIndicatorVisible = isNotificationIndicatorVisible;
+    [animator cancelNotificationIndicatorTransitionForButton:self];
 
-    if (isNotificationIndicatorVisible) {
-        void (^animations)(void) = ^(void) {
-            [self layoutIfNeeded];
-            notificationIndicatorView.alpha = 1.0;
-        };
-        if (animated == false) {
-            [self setNeedsLayout];
-            animations();
-        } else {
-            notificationIndicatorView.alpha = 0.0;
-            [self setNeedsLayout];
-            void (^completion)(BOOL) = ^(BOOL finished) {
-                if (self->_notificationIndicatorViewAnimationState == _TBTabBarButtonNotificationIndicatorViewAnimationStateShow) {
-                    self->_notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateNone;
-                }
-            };
-            _TBTabBarButtonNotificationIndicatorViewAnimationState const _prevAnimationState = _notificationIndicatorViewAnimationState;
-            _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateShow;
-            // When there is a very small (less than animation duration) gap in time between hiding and showing the indicator view we should animate it without extra spring animation to make it look smooth
-            if (_prevAnimationState == _TBTabBarButtonNotificationIndicatorViewAnimationStateHide) {
-                [UIView animateWithDuration:[self notificationIndicatorAnimationDuration:true] delay:0.0 options:UIViewAnimationOptionTransitionCrossDissolve | UIViewAnimationOptionBeginFromCurrentState animations:animations completion:completion];
-            } else {
-                [UIView animateWithDuration:[self notificationIndicatorAnimationDuration:true] delay:0.0 usingSpringWithDamping:0.5 initialSpringVelocity:0.25 options:UIViewAnimationOptionTransitionCrossDissolve | UIViewAnimationOptionBeginFromCurrentState animations:animations completion:completion];
-            }
-        }
-    } else {
-        if (animated == false) {
-            notificationIndicatorView.alpha = 0.0;
-            if (notificationIndicatorView.superview != nil) {
-                [notificationIndicatorView removeFromSuperview];
-            }
-        } else {
-            _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateHide;
-            [self setNeedsLayout];
-            [UIView animateWithDuration:[self notificationIndicatorAnimationDuration:false] delay:0.0 options:UIViewAnimationOptionBeginFromCurrentState animations:^{
-                [self layoutIfNeeded];
-                notificationIndicatorView.alpha = 0.0;
-            } completion:^(BOOL finished) {
-                if (self->_notificationIndicatorViewAnimationState == _TBTabBarButtonNotificationIndicatorViewAnimationStateHide) {
-                    [notificationIndicatorView removeFromSuperview];
-                    self->_notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateNone;
-                }
-            }];
-        }
-    }
+    [self _prepareNotificationIndicatorTransitionToHidden:hidden];
+
+    [UIView performWithoutAnimation:^{
+        [self _animateNotificationIndicatorTransitionToHidden:hidden];
+    }];
+
+    [self _finishNotificationIndicatorTransitionToHidden:hidden];
 }
 
 #pragma mark Overrides
@@ -186,25 +152,7 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
 
     _needsLayout = false;
 
-    CGRect const bounds = self.bounds;
-
-    // Tab icon
-
-    UIImageView *imageView = self.imageView;
-
-    if (imageView.superview != nil && imageView.image != nil) {
-        
-        imageView.frame = [self imageViewFrameForBounds:bounds];
-    }
-
-    // Notification indicator
-
-    UIImageView *notificationIndicatorView = self.notificationIndicatorView;
-
-    if (notificationIndicatorView.superview != nil) {
-        
-        notificationIndicatorView.frame = [self notificationIndicatorViewFrameForBounds:bounds];
-    }
+    [self _layoutContentForBounds:self.bounds];
 }
 
 - (void)tintColorDidChange {
@@ -214,7 +162,17 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
     UIColor *const tintColor = self.tintColor;
 
     if (self.isSelected) {
-        self.imageView.tintColor = tintColor;
+        _imageView.tintColor = tintColor;
+    }
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // The badge bitmap depends on the display scale and on dynamic colors
+    if (_badgeImage != nil) {
+        [self _updateBadge];
     }
 }
 
@@ -235,58 +193,80 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
     _notificationIndicatorVisible = tabBarItem.showsNotificationIndicator;
     _notificationIndicatorInsets = _laysOutHorizontally ? UIEdgeInsetsMake(0.0, 0.0, 0.0, 5.0) : UIEdgeInsetsMake(0.0, 0.0, 3.0, 0.0);
     _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateNone;
+    // Badge
+    _badgeValue = [tabBarItem.badgeValue copy];
 }
 
 - (void)_setup {
     // UI
     // Tab icon
-    if (_normalImage != nil) {
-        [self addSubview:self.imageView];
-    }
+    [self _updateImage];
     // Notification indicator
     if (self.isNotificationIndicatorVisible) {
-        [self addSubview:self.notificationIndicatorView];
+        [self setNotificationIndicatorHidden:false animated:false];
     }
+    // Badge
+    [self _updateBadge];
 }
 
 #pragma mark Helpers
 
 - (void)_updateImage {
 
-    UIImage *image = nil;
+    [self _displayImage:[self _imageForCurrentState]];
+}
 
-    if (self.isHighlighted) {
-        if (self.isSelected) {
-            image = _highlightedAndSelectedImage;
-        } else {
-            image = _highlightedImage;
+- (void)_updateBadge {
+
+    if (_badgeValue.length == 0) {
+        if (_badgeLayer.superlayer != nil) {
+            [_badgeLayer removeFromSuperlayer];
         }
-    } else if (self.isEnabled == false) {
-        image = _disabledImage;
-    } else if (self.isSelected) {
-        image = _selectedImage;
+        _badgeImage = nil;
+        return;
     }
 
-    if (image == nil && _normalImage != nil) {
-        image = _normalImage;
+    UIColor *textColor = self.badgeTextColor;
+    UIColor *backgroundColor = self.badgeColor;
+
+    if (@available(iOS 13.0, *)) {
+        UITraitCollection *traitCollection = self.traitCollection;
+        textColor = [textColor resolvedColorWithTraitCollection:traitCollection];
+        backgroundColor = [backgroundColor resolvedColorWithTraitCollection:traitCollection];
     }
 
-    UIImageView *imageView = self.imageView;
+    UIImage *badgeImage = [[_TBBadgeRenderer sharedRenderer] badgeImageForValue:_badgeValue
+                                                                           font:self.badgeFont
+                                                                      textColor:textColor
+                                                                backgroundColor:backgroundColor
+                                                                          scale:self.tb_displayScale];
 
-    UIImage *prevImage = imageView.image;
+    if (badgeImage == _badgeImage) {
+        return;
+    }
 
-    imageView.image = image;
+    CGSize const prevBadgeSize = _badgeImage.size;
 
-    if (imageView.superview == nil && imageView.image != nil) {
-        [self addSubview:imageView];
+    _badgeImage = badgeImage;
+
+    if (_badgeLayer == nil) {
+        _badgeLayer = [CALayer layer];
+        // Badge updates are frequent and must not be animated implicitly
+        _badgeLayer.actions = @{
+            @"bounds": [NSNull null],
+            @"position": [NSNull null],
+            @"contents": [NSNull null]
+        };
+    }
+
+    _badgeLayer.contents = (__bridge id)badgeImage.CGImage;
+    _badgeLayer.contentsScale = badgeImage.scale;
+
+    if (_badgeLayer.superlayer == nil) {
+        [self.layer addSublayer:_badgeLayer];
         [self setNeedsLayout];
-    } else if (imageView.superview != nil && imageView.image == nil) {
-        [imageView removeFromSuperview];
+    } else if (CGSizeEqualToSize(prevBadgeSize, badgeImage.size) == false) {
         [self setNeedsLayout];
-    } else {
-        if ([prevImage isEqual:image] == false) {
-            [self setNeedsLayout];
-        }
     }
 }
 
@@ -322,6 +302,33 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
     return _notificationIndicatorView;
 }
 
+- (UIFont *)badgeFont {
+
+    if (_badgeFont == nil) {
+        _badgeFont = [UIFont monospacedDigitSystemFontOfSize:_TBTabBarButtonBadgeFontSize weight:UIFontWeightSemibold];
+    }
+
+    return _badgeFont;
+}
+
+- (UIColor *)badgeTextColor {
+
+    if (_badgeTextColor == nil) {
+        _badgeTextColor = [UIColor whiteColor];
+    }
+
+    return _badgeTextColor;
+}
+
+- (UIColor *)badgeColor {
+
+    if (_badgeColor == nil) {
+        _badgeColor = [UIColor systemRedColor];
+    }
+
+    return _badgeColor;
+}
+
 #pragma mark Setters
 
 - (void)setFrame:(CGRect)frame {
@@ -386,11 +393,32 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
 
     _notificationIndicatorSize = notificationIndicatorSize;
 
-    if (self.notificationIndicatorView.superview != nil && self.notificationIndicatorVisible == false) {
+    if (_notificationIndicatorView.superview != nil && self.notificationIndicatorVisible == false) {
         [self setNeedsLayout];
     }
 }
 
+- (void)setBadgeFont:(UIFont *)badgeFont {
+
+    _badgeFont = badgeFont;
+
+    [self _updateBadge];
+}
+
+- (void)setBadgeTextColor:(UIColor *)badgeTextColor {
+
+    _badgeTextColor = badgeTextColor;
+
+    [self _updateBadge];
+}
+
+- (void)setBadgeColor:(UIColor *)badgeColor {
+
+    _badgeColor = badgeColor;
+
+    [self _updateBadge];
+}
+
 - (void)setNotificationIndicatorInsets:(UIEdgeInsets)notificationIndicatorInsets {
 
     if (UIEdgeInsetsEqualToEdgeInsets(_notificationIndicatorInsets, notificationIndicatorInsets)) {
@@ -482,6 +510,24 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
     return _TBPixelAccurateRect((CGRect){indicatorOrigin, indicatorSize}, displayScale, true);
 }
 
+- (CGRect)badgeFrameForBounds:(CGRect)bounds badgeSize:(CGSize)badgeSize {
+
+    CGRect const imageViewFrame = [self imageViewFrameForBounds:bounds];
+
+    CGFloat const centerX = self.tb_isLeftToRight ? CGRectGetMaxX(imageViewFrame) : CGRectGetMinX(imageViewFrame);
+
+    CGRect badgeFrame = (CGRect){
+        (CGPoint){centerX - (badgeSize.width / 2.0), CGRectGetMinY(imageViewFrame) - (badgeSize.height / 2.0)},
+        badgeSize
+    };
+
+    // Keep the badge within the button
+    badgeFrame.origin.x = MIN(MAX(CGRectGetMinX(bounds), CGRectGetMinX(badgeFrame)), CGRectGetMaxX(bounds) - badgeSize.width);
+    badgeFrame.origin.y = MAX(CGRectGetMinY(bounds), CGRectGetMinY(badgeFrame));
+
+    return _TBPixelAccurateRect(badgeFrame, self.tb_displayScale, false);
+}
+
 - (NSTimeInterval)notificationIndicatorAnimationDuration:(BOOL)presenting {
 
     return presenting ?
@@ -490,3 +536,174 @@ typedef NS_ENUM(NSUInteger, _TBTabBarButtonNotificationIndicatorViewAnimationSta
 }
 
 @end
+
+#pragma mark - Private
+
+@implementation TBTabBarButton (Private)
+
+- (void)_setTabBarItem:(TBTabBarItem *)tabBarItem {
+
+    if (_tabBarItem == tabBarItem) {
+        return;
+    }
+
+    _tabBarItem = tabBarItem;
+
+    self.enabled = tabBarItem.isEnabled;
+
+    if (_normalImage != tabBarItem.image || _selectedImage != tabBarItem.selectedImage) {
+        _normalImage = tabBarItem.image;
+        _selectedImage = tabBarItem.selectedImage;
+        [self _updateImage];
+    }
+
+    [self _setNotificationIndicatorImage:tabBarItem.notificationIndicator];
+
+    // The visibility flag lags behind a pending animated transition, so the request is always forwarded to be merged with it
+    [self setNotificationIndicatorHidden:!tabBarItem.showsNotificationIndicator animated:self.window != nil];
+
+    [self _setBadgeValue:tabBarItem.badgeValue];
+}
+
+- (UIImage *)_imageForCurrentState {
+
+    UIImage *image = nil;
+
+    if (self.isHighlighted) {
+        if (self.isSelected) {
+            image = _highlightedAndSelectedImage;
+        } else {
+            image = _highlightedImage;
+        }
+    } else if (self.isEnabled == false) {
+        image = _disabledImage;
+    } else if (self.isSelected) {
+        image = _selectedImage;
+    }
+
+    if (image == nil && _normalImage != nil) {
+        image = _normalImage;
+    }
+
+    return image;
+}
+
+- (void)_displayImage:(UIImage *)image {
+
+    UIImageView *imageView = self.imageView;
+
+    UIImage *prevImage = imageView.image;
+
+    imageView.image = image;
+
+    if (imageView.superview == nil && imageView.image != nil) {
+        [self addSubview:imageView];
+        [self setNeedsLayout];
+    } else if (imageView.superview != nil && imageView.image == nil) {
+        [imageView removeFromSuperview];
+        [self setNeedsLayout];
+    } else {
+        if ([prevImage isEqual:image] == false) {
+            [self setNeedsLayout];
+        }
+    }
+}
+
+- (void)_layoutContentForBounds:(CGRect)bounds {
+
+    // Tab icon
+
+    if (_imageView.superview != nil && _imageView.image != nil) {
+        _imageView.frame = [self imageViewFrameForBounds:bounds];
+    }
+
+    // Notification indicator
+
+    if (_notificationIndicatorView.superview != nil) {
+        _notificationIndicatorView.frame = [self notificationIndicatorViewFrameForBounds:bounds];
+    }
+
+    // Badge
+
+    if (_badgeLayer.superlayer != nil) {
+        _badgeLayer.frame = [self badgeFrameForBounds:bounds badgeSize:_badgeImage.size];
+    }
+}
+
+- (void)_setNotificationIndicatorImage:(UIImage *)image {
+
+    if ([self.notificationIndicatorView isKindOfClass:[UIImageView class]]) {
+        ((UIImageView *)self.notificationIndicatorView).image = image;
+    }
+}
+
+- (void)_setNotificationIndicatorTintColor:(UIColor *)tintColor {
+
+    self.notificationIndicatorView.tintColor = tintColor;
+}
+
+- (void)_setBadgeValue:(NSString *)badgeValue {
+
+    if (_badgeValue == badgeValue || [_badgeValue isEqualToString:badgeValue]) {
+        return;
+    }
+
+    _badgeValue = [badgeValue copy];
+
+    [self _updateBadge];
+}
+
+- (BOOL)_prepareNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    _TBTabBarButtonNotificationIndicatorViewAnimationState const prevAnimationState = _notificationIndicatorViewAnimationState;
+
+    if (hidden) {
+        _notificationIndicatorVisible = false;
+        _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateHide;
+        return false;
+    }
+
+    UIView *notificationIndicatorView = self.notificationIndicatorView;
+
+    if (notificationIndicatorView.superview == nil) {
+        // The indicator appears from its hidden position, so the frame is computed before changing the visibility
+        _notificationIndicatorVisible = false;
+        notificationIndicatorView.alpha = 0.0;
+        notificationIndicatorView.frame = [self notificationIndicatorViewFrameForBounds:self.bounds];
+        [self addSubview:notificationIndicatorView];
+    }
+
+    _notificationIndicatorVisible = true;
+    _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateShow;
+
+    // When there is a very small (less than animation duration) gap in time between hiding and showing the indicator view we should animate it without extra spring animation to make it look smooth
+    return prevAnimationState != _TBTabBarButtonNotificationIndicatorViewAnimationStateHide;
+}
+
+- (void)_animateNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    UIView *notificationIndicatorView = _notificationIndicatorView;
+
+    if (notificationIndicatorView.superview == nil) {
+        return;
+    }
+
+    notificationIndicatorView.frame = [self notificationIndicatorViewFrameForBounds:self.bounds];
+    notificationIndicatorView.alpha = hidden ? 0.0 : 1.0;
+}
+
+- (void)_finishNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    if (hidden) {
+        if (_notificationIndicatorViewAnimationState == _TBTabBarButtonNotificationIndicatorViewAnimationStateHide) {
+            [_notificationIndicatorView removeFromSuperview];
+            _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateNone;
+        }
+    } else {
+        if (_notificationIndicatorViewAnimationState == _TBTabBarButtonNotificationIndicatorViewAnimationStateShow) {
+            _notificationIndicatorViewAnimationState = _TBTabBarButtonNotificationIndicatorViewAnimationStateNone;
+        }
+    }
+}
+
+@end
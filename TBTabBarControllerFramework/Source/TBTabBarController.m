@@ -29,27 +29,45 @@
 #import "TBTabBarController+Private.h"
 #import "TBTabBar+Private.h"
 #import "TBTabBarButton.h"
+#import "TBTabBarAppearance.h"
+#import "TBTabBarControllerEventTrace.h"
+#import "TBTabBarFootprint.h"
+#import "TBTabBarHitchMonitor.h"
+#import "TBTabBarSelectionHistory.h"
 #import "_TBUtils.h"
+#import "_TBSceneResources.h"
 #import "UIView+Extensions.h"
 #import "_TBTabBarControllerTransitionContext.h"
 #import "_TBTabBarControllerTransitionState.h"
 #import "_TBTabBarControllerTransitionAnimator.h"
 #import "NSArray+Extensions.h"
+#import "UINavigationController+Extensions.h"
 
 #import <objc/runtime.h>
 
+static NSTimeInterval const _TBTabBarControllerLiveResizeSettleAnimationDuration = 0.25;
+
 typedef NS_OPTIONS(NSUInteger, _TBTabBarControllerMethodOverrides) {
     _TBTabBarControllerMethodOverrideNone = 0,
     _TBTabBarControllerMethodOverridePreferredTabBarPlacementForHorizontalSizeClass = 1 << 0,
     _TBTabBarControllerMethodOverridePreferredTabBarPlacementForViewSize = 1 << 1
 };
 
+/// Everything a placement change touches, computed before any of it is applied
+typedef struct _TBTabBarControllerPlacementLayout {
+    CGRect horizontalTabBarFrame;
+    CGRect verticalTabBarFrame;
+    CGRect dummyBarFrame;
+    UIEdgeInsets additionalSafeAreaInsets;
+} _TBTabBarControllerPlacementLayout;
+
 static void *tbtbbrcntrlr_tabBarItemTitleContext = &tbtbbrcntrlr_tabBarItemTitleContext;
 static void *tbtbbrcntrlr_tabBarItemImageContext = &tbtbbrcntrlr_tabBarItemImageContext;
 static void *tbtbbrcntrlr_tabBarItemSelectedImageContext = &tbtbbrcntrlr_tabBarItemSelectedImageContext;
 static void *tbtbbrcntrlr_tabBarItemNotificationIndicatorContext = &tbtbbrcntrlr_tabBarItemNotificationIndicatorContext;
 static void *tbtbbrcntrlr_tabBarItemShowsNotificationIndicatorContext = &tbtbbrcntrlr_tabBarItemShowsNotificationIndicatorContext;
 static void *tbtbbrcntrlr_tabBarItemEnabledContext = &tbtbbrcntrlr_tabBarItemEnabledContext;
+static void *tbtbbrcntrlr_tabBarItemBadgeValueContext = &tbtbbrcntrlr_tabBarItemBadgeValueContext;
 
 #pragma mark - Tab bar controller
 
@@ -65,6 +83,37 @@ static void *tbtbbrcntrlr_tabBarItemEnabledContext = &tbtbbrcntrlr_tabBarItemEna
 
 static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
+static char *_tabBarControllerOwnerKey;
+
+/// Bumped whenever a tab bar controller rearranges its hierarchy, which makes every cached `tb_tabBarController` stale
+static NSUInteger tbtbbrcntrlr_hierarchyGeneration = 1;
+
+/// A weak reference to a tab bar controller along with the hierarchy generation it was looked up in
+@interface _TBTabBarControllerReference : NSObject
+
+@property (weak, nonatomic, readonly) TBTabBarController *tabBarController;
+@property (assign, nonatomic, readonly) NSUInteger generation;
+
+- (instancetype)initWithTabBarController:(TBTabBarController *)tabBarController;
+
+@end
+
+@implementation _TBTabBarControllerReference
+
+- (instancetype)initWithTabBarController:(TBTabBarController *)tabBarController {
+
+    self = [super init];
+
+    if (self) {
+        _tabBarController = tabBarController;
+        _generation = tbtbbrcntrlr_hierarchyGeneration;
+    }
+
+    return self;
+}
+
+@end
+
 @implementation TBTabBarController {
 
     __weak UINavigationController *tbtbbrcntrlr_nestedNavigationController;
@@ -72,10 +121,18 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
     CGFloat tbtbbrcntrlr_dummyBarInternalHeight;
 
+    CFTimeInterval tbtbbrcntrlr_lastSizeTransitionTimestamp;
+    TBTabBarControllerTabBarPlacement tbtbbrcntrlr_liveResizeThresholdPlacement; // What the subclass wanted for the last size that was fully evaluated
+
     BOOL tbtbbrcntrlr_needsLayout;
     BOOL tbtbbrcntrlr_needsUpdateTabBarPlacement;
-    BOOL tbtbbrcntrlr_selectedViewControllerNeedsLayout;
     BOOL tbtbbrcntrlr_isTransitioning;
+    BOOL tbtbbrcntrlr_isUpdatingBadgeValues;
+    BOOL tbtbbrcntrlr_isSelectingPreviousTab;
+    BOOL tbtbbrcntrlr_isChangingHorizontalSizeClass;
+    BOOL tbtbbrcntrlr_needsSettleLiveResize; // The live resize settled while a tab bar transition was in flight
+
+    NSUInteger tbtbbrcntrlr_eventDepth; // The number of public calls in flight that have recorded their events
 }
 
 @synthesize dummyBar = _dummyBar;
@@ -189,46 +246,54 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
 - (void)beginTabBarTransition {
 
-    tbtbbrcntrlr_selectedViewControllerNeedsLayout = true;
-
     [self tbtbbrcntrlr_beginTabBarTransition];
 }
 
 - (void)endTabBarTransition {
 
-    tbtbbrcntrlr_selectedViewControllerNeedsLayout = false;
-
     [self tbtbbrcntrlr_endTabBarTransition];
 }
 
 - (void)addItem:(__kindof TBTabBarItem *)item {
 
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeInsertItem firstArgument:_items.count secondArgument:0];
+
     [self tbtbbrcntrlr_observeItem:item];
 
     [_items addObject:item];
 
     [self.horizontalTabBar _setItems:_items];
     [self.verticalTabBar _setItems:_items];
+
+    [self tbtbbrcntrlr_endEvent];
 }
 
 - (void)insertItem:(__kindof TBTabBarItem *)item atIndex:(NSUInteger)index {
 
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeInsertItem firstArgument:index secondArgument:0];
+
     [self tbtbbrcntrlr_observeItem:item];
 
     [_items insertObject:item atIndex:index];
 
     [self.horizontalTabBar _setItems:_items];
     [self.verticalTabBar _setItems:_items];
+
+    [self tbtbbrcntrlr_endEvent];
 }
 
 - (void)removeItemAtIndex:(NSUInteger)index {
 
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeRemoveItem firstArgument:index secondArgument:0];
+
     TBTabBarItem *item = _items[index];
 
     [self tbtbbrcntrlr_removeObserverForItem:item];
 
     [_items removeObjectAtIndex:index];
 
+    [_selectionHistory removeItem:item];
+
     [self.horizontalTabBar _setItems:_items];
     [self.verticalTabBar _setItems:_items];
 
@@ -236,51 +301,240 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
         return [viewController.tb_tabBarItem isEqualToItem:item];
     }];
 
-    if (viewControllerToRemove == nil) {
+    if (viewControllerToRemove != nil) {
+        // The tabs are rebuilt without the view controller, which is a part of the removal rather than an event of its own
+        NSMutableArray<UIViewController *> *viewControllers = [self.viewControllers mutableCopy];
+        [viewControllers removeObject:viewControllerToRemove];
+        self.viewControllers = viewControllers;
+        [self tbtbbrcntrlr_selectFirstSelectableViewController];
+    }
+
+    [self tbtbbrcntrlr_endEvent];
+}
+
+- (void)moveItemAtIndex:(NSUInteger)index toIndex:(NSUInteger)newIndex {
+
+    NSUInteger const itemsCount = _items.count;
+
+    if (index == newIndex || index >= itemsCount || newIndex >= itemsCount) {
         return;
     }
 
-    NSMutableArray<UIViewController *> *viewControllers = [self.viewControllers mutableCopy];
-    [viewControllers removeObject:viewControllerToRemove];
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeMoveItem firstArgument:index secondArgument:newIndex];
+
+    TBTabBarItem *item = _items[index];
 
-    self.viewControllers = viewControllers;
+    [_items removeObjectAtIndex:index];
+    [_items insertObject:item atIndex:newIndex];
 
-    if (viewControllers.count == 0) {
+    NSArray<__kindof UIViewController *> *viewControllers = _viewControllers;
+
+    if (index < viewControllers.count && newIndex < viewControllers.count && [viewControllers[index] tb_tabBarItem] == item) {
+        // Items are captured from the view controllers in the same order, so the view controller moves the same way.
+        // It is only reordered, so nothing is observed or owned again.
+        NSMutableArray<__kindof UIViewController *> *reorderedViewControllers = [viewControllers mutableCopy];
+        UIViewController *viewController = reorderedViewControllers[index];
+        [reorderedViewControllers removeObjectAtIndex:index];
+        [reorderedViewControllers insertObject:viewController atIndex:newIndex];
+        _viewControllers = [reorderedViewControllers copy];
+    }
+
+    // The tab bar the tab was dragged in already matches, so only the other one moves its button
+
+    [self.horizontalTabBar _setItems:_items];
+    [self.verticalTabBar _setItems:_items];
+
+    [self tbtbbrcntrlr_updateTabBarsSelection];
+
+    [self tbtbbrcntrlr_endEvent];
+}
+
+- (void)applyItemIdentifiers:(NSArray<NSString *> *)itemIdentifiers {
+
+    // Copies of an item share its identifier, so every identifier maps to the tabs that have it, in their current order
+
+    NSMutableDictionary<NSString *, NSMutableArray<TBTabBarItem *> *> *currentItems = [NSMutableDictionary dictionaryWithCapacity:_items.count];
+
+    for (TBTabBarItem *item in _items) {
+        NSMutableArray<TBTabBarItem *> *identifiedItems = currentItems[item.itemIdentifier];
+        if (identifiedItems == nil) {
+            currentItems[item.itemIdentifier] = [NSMutableArray arrayWithObject:item];
+        } else {
+            [identifiedItems addObject:item];
+        }
+    }
+
+    NSMutableArray<TBTabBarItem *> *items = [NSMutableArray arrayWithCapacity:itemIdentifiers.count];
+
+    for (NSString *itemIdentifier in itemIdentifiers) {
+        NSMutableArray<TBTabBarItem *> *identifiedItems = currentItems[itemIdentifier];
+        if (identifiedItems.count > 0) {
+            // Every occurrence of an identifier takes the next tab that has it, the ones past the last tab are ignored
+            [items addObject:identifiedItems.firstObject];
+            [identifiedItems removeObjectAtIndex:0];
+        }
+    }
+
+    NSMutableArray<TBTabBarItem *> *removedItems = [NSMutableArray array];
+
+    for (NSArray<TBTabBarItem *> *identifiedItems in currentItems.objectEnumerator) {
+        [removedItems addObjectsFromArray:identifiedItems];
+    }
+
+    if ([items isEqualToArray:_items]) {
         return;
     }
 
-    UIViewController *viewControllerToSelect;
+    // Whatever is left has been removed
 
-    if (_delegateFlags.shouldSelectItemAtIndex) {
-        for (UIViewController *viewController in viewControllers) {
-            if ([self.delegate tabBarController:self shouldSelectViewController:viewController]) {
-                viewControllerToSelect = viewController;
-                break;
+    for (TBTabBarItem *item in removedItems) {
+        [_selectionHistory removeItem:item];
+    }
+
+    // Buttons keep their selection state while they move, so it is reset beforehand
+
+    [self.horizontalTabBar _deselect];
+    [self.verticalTabBar _deselect];
+
+    __kindof UIViewController *selectedViewController = _selectedViewController;
+
+    if (self.viewControllers.count > 0) {
+        // View controllers follow their items, the items are captured from them again
+        NSMutableArray<UIViewController *> *viewControllers = [NSMutableArray arrayWithCapacity:items.count];
+        for (TBTabBarItem *item in items) {
+            UIViewController *viewController = [self.viewControllers firstObject:^BOOL(__kindof UIViewController *_Nonnull viewController) {
+                return viewController.tb_tabBarItem == item;
+            }];
+            if (viewController != nil) {
+                [viewControllers addObject:viewController];
             }
         }
+        self.viewControllers = viewControllers;
     } else {
-        viewControllerToSelect = viewControllers.firstObject;
+        for (TBTabBarItem *item in removedItems) {
+            [self tbtbbrcntrlr_removeObserverForItem:item];
+        }
+        [_items setArray:items];
+        [self.horizontalTabBar _setItems:_items];
+        [self.verticalTabBar _setItems:_items];
     }
 
-    if (viewControllerToSelect == nil) {
+    if (selectedViewController != nil && [self.viewControllers indexOfObjectIdenticalTo:selectedViewController] == NSNotFound) {
+        [self tbtbbrcntrlr_selectFirstSelectableViewController];
+    } else {
+        [self tbtbbrcntrlr_updateTabBarsSelection];
+    }
+}
+
+- (void)setBadgeValues:(NSMapTable<__kindof TBTabBarItem *, NSString *> *)badgeValues {
+
+    if (badgeValues.count == 0) {
         return;
     }
 
-    NSUInteger const viewControllerIndexToSelect = [viewControllers indexOfObject:viewControllerToSelect];
+    tbtbbrcntrlr_isUpdatingBadgeValues = true;
 
-    [self tbtbbrcntrlr_moveToViewControllerAtIndex:viewControllerIndexToSelect];
+    for (TBTabBarItem *item in badgeValues) {
+        NSString *badgeValue = [badgeValues objectForKey:item];
+        item.badgeValue = (badgeValue.length > 0) ? badgeValue : nil;
+    }
 
-    NSUInteger const hTabBarItemIndexToSelect = [self.horizontalTabBar.visibleItems indexOfObject:viewControllerToSelect.tb_tabBarItem];
+    tbtbbrcntrlr_isUpdatingBadgeValues = false;
 
-    [self.horizontalTabBar _setSelectedIndex:hTabBarItemIndexToSelect quietly:true];
+    // Only the visible tab bar is updated right away, the other one catches up when it is shown
 
-    NSUInteger const vTabBarItemIndexToSelect = [self.verticalTabBar.visibleItems indexOfObject:viewControllerToSelect.tb_tabBarItem];
+    TBTabBar *visibleTabBar = self.visibleTabBar;
 
-    [self.verticalTabBar _setSelectedIndex:vTabBarItemIndexToSelect quietly:true];
+    for (TBTabBar *tabBar in @[self.horizontalTabBar, self.verticalTabBar]) {
+        if (tabBar == visibleTabBar) {
+            [tabBar _updateBadgeValues];
+        } else {
+            [tabBar _setNeedsUpdateBadgeValues];
+        }
+    }
+}
 
-    if (_delegateFlags.didSelectViewController) {
-        [self.delegate tabBarController:self didSelectViewController:viewControllerToSelect];
+- (void)applyTabBarAppearance:(TBTabBarAppearance *)appearance {
+
+    // Controllers of the same scene applying the same appearance share one snapshot
+
+    TBTabBarAppearance *snapshot = self.isViewLoaded ? [[_TBSceneResources resourcesForView:self.view] snapshotOfAppearance:appearance] : [appearance copy];
+
+    [self.horizontalTabBar applyAppearance:snapshot];
+    [self.verticalTabBar applyAppearance:snapshot];
+}
+
+- (void)registerNavigationController:(UINavigationController *)navigationController {
+
+    UINavigationController *nestedNavigationController = tbtbbrcntrlr_nestedNavigationController;
+
+    if (nestedNavigationController != nil && ![nestedNavigationController isEqual:navigationController]) {
+        [self unregisterNavigationController:nestedNavigationController];
     }
+
+    tbtbbrcntrlr_nestedNavigationController = navigationController;
+
+    [navigationController tb_attachToTabBarController:self];
+}
+
+- (void)unregisterNavigationController:(UINavigationController *)navigationController {
+
+    [navigationController tb_detachFromTabBarController];
+
+    if ([tbtbbrcntrlr_nestedNavigationController isEqual:navigationController]) {
+        tbtbbrcntrlr_nestedNavigationController = nil;
+    }
+}
+
+- (BOOL)selectPreviousTab {
+
+    TBTabBarItem *previousItem = _selectionHistory.previousItem;
+
+    if (previousItem == nil) {
+        return false;
+    }
+
+    NSUInteger const index = [self.viewControllers indexOfObjectPassingTest:^BOOL(__kindof UIViewController *_Nonnull viewController, NSUInteger index, BOOL * _Nonnull stop) {
+        return viewController.tb_tabBarItem == previousItem;
+    }];
+
+    if (index == NSNotFound) {
+        return false;
+    }
+
+    // The history is popped only if the selection goes through, the delegate may prevent it
+
+    tbtbbrcntrlr_isSelectingPreviousTab = true;
+
+    self.selectedIndex = index;
+
+    tbtbbrcntrlr_isSelectingPreviousTab = false;
+
+    return _selectedViewController.tb_tabBarItem == previousItem;
+}
+
+- (NSArray<TBTabBarFootprint *> *)footprintsOfTabs {
+
+    NSMutableArray<TBTabBarFootprint *> *footprints = [NSMutableArray arrayWithCapacity:_items.count];
+
+    NSArray<TBTabBar *> *tabBars = @[self.horizontalTabBar, self.verticalTabBar];
+
+    for (TBTabBarItem *item in _items) {
+        UIViewController *viewController = [self.viewControllers firstObject:^BOOL(__kindof UIViewController *_Nonnull viewController) {
+            return viewController.tb_tabBarItem == item;
+        }];
+        // Hidden tabs have no buttons
+        NSMutableArray<TBTabBarButton *> *buttons = [NSMutableArray arrayWithCapacity:tabBars.count];
+        for (TBTabBar *tabBar in tabBars) {
+            NSUInteger const index = [tabBar.visibleItems indexOfObjectIdenticalTo:item];
+            if (index != NSNotFound) {
+                [buttons addObject:[tabBar _buttons][index]];
+            }
+        }
+        [footprints addObject:[[TBTabBarFootprint alloc] initWithItem:item viewController:viewController buttons:buttons]];
+    }
+
+    return [footprints copy];
 }
 
 #pragma mark Overrides
@@ -297,6 +551,17 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     [self tbtbbrcntrlr_setup];
 }
 
+- (void)viewWillDisappear:(BOOL)animated {
+
+    [super viewWillDisappear:animated];
+
+    if (_liveResizing) {
+        // The pending request retains the controller, and nothing is left to animate once the view is gone
+        [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(tbtbbrcntrlr_settleLiveResize) object:nil];
+        [self tbtbbrcntrlr_settleLiveResizeAnimated:false];
+    }
+}
+
 - (void)viewDidLayoutSubviews {
 
     [super viewDidLayoutSubviews];
@@ -346,6 +611,8 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     UIUserInterfaceSizeClass const newHorizontalSizeClass = newCollection.horizontalSizeClass;
 
     if (self.traitCollection.horizontalSizeClass != newHorizontalSizeClass) {
+
+        tbtbbrcntrlr_isChangingHorizontalSizeClass = true;
         
         _preferredPlacement = [self tbtbbrcntrlr_preferredTabBarPlacementForSizeClass:newHorizontalSizeClass];
     }
@@ -355,6 +622,31 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
        withTransitionCoordinator:(id <UIViewControllerTransitionCoordinator>)coordinator {
 
     if (CGSizeEqualToSize(self.view.bounds.size, size) == false) {
+
+        [_eventRecorder recordEvent:TBTabBarControllerEventTypeTransitionToSize
+                      firstArgument:(NSUInteger)MAX(0.0, round(size.width))
+                     secondArgument:(NSUInteger)MAX(0.0, round(size.height))];
+
+        CFTimeInterval const timestamp = CACurrentMediaTime();
+
+        BOOL const continuesLiveResize = _liveResizeSettleInterval > 0.0 &&
+                                         (_liveResizing || timestamp - tbtbbrcntrlr_lastSizeTransitionTimestamp < _liveResizeSettleInterval);
+
+        tbtbbrcntrlr_lastSizeTransitionTimestamp = timestamp;
+
+        if (continuesLiveResize && ![self tbtbbrcntrlr_crossesPlacementThresholdForSize:size]) {
+            [self tbtbbrcntrlr_continueLiveResize];
+            [super viewWillTransitionToSize:size withTransitionCoordinator:coordinator];
+            return;
+        }
+
+        if (continuesLiveResize) {
+            // The placement changes in the middle of the drag, the size is evaluated in full once it settles as well
+            [self tbtbbrcntrlr_continueLiveResize];
+        }
+
+        tbtbbrcntrlr_isChangingHorizontalSizeClass = false;
+        tbtbbrcntrlr_liveResizeThresholdPlacement = [self tbtbbrcntrlr_thresholdPlacementForSize:size];
         
         __weak typeof(self) weakSelf = self;
 
@@ -404,11 +696,16 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
     [self currentlyVisibleTabBar:&horizontalTabBar hiddenTabBar:&verticalTabBar];
 
-    NSUInteger const verticalTabBarButtonIndex = [horizontalTabBar.items indexOfObject:object];
-    NSUInteger const hiddenTabBarButtonIndex = [verticalTabBar.items indexOfObject:object];
+    // Items are compared by identity, equal items may belong to different tabs
+    NSUInteger const verticalTabBarButtonIndex = [horizontalTabBar.items indexOfObjectIdenticalTo:object];
+    NSUInteger const hiddenTabBarButtonIndex = [verticalTabBar.items indexOfObjectIdenticalTo:object];
 
     id newValue = change[NSKeyValueChangeNewKey];
 
+    if (_eventRecorder != nil) {
+        [self tbtbbrcntrlr_recordChangeOfItem:object context:context];
+    }
+
     if (tbtbbrcntrlr_tabBarItemImageContext == context && [keyPath isEqualToString:NSStringFromSelector(@selector(image))]) {
         [horizontalTabBar _setNormalImage:newValue forButtonAtIndex:verticalTabBarButtonIndex];
         [verticalTabBar _setNormalImage:newValue forButtonAtIndex:hiddenTabBarButtonIndex];
@@ -426,6 +723,15 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
         [horizontalTabBar _setNotificationIndicatorHidden:isNotificationIndicatorHidden forButtonAtIndex:verticalTabBarButtonIndex];
         [verticalTabBar _setNotificationIndicatorHidden:isNotificationIndicatorHidden forButtonAtIndex:hiddenTabBarButtonIndex];
         return;
+    } else if (tbtbbrcntrlr_tabBarItemBadgeValueContext == context && [keyPath isEqualToString:NSStringFromSelector(@selector(badgeValue))]) {
+        if (tbtbbrcntrlr_isUpdatingBadgeValues) {
+            // Bars are updated at once at the end of the batch
+            return;
+        }
+        NSString *badgeValue = (newValue != [NSNull null]) ? newValue : nil;
+        [horizontalTabBar _setBadgeValue:badgeValue forButtonAtIndex:verticalTabBarButtonIndex];
+        [verticalTabBar _setBadgeValue:badgeValue forButtonAtIndex:hiddenTabBarButtonIndex];
+        return;
     } else if (tbtbbrcntrlr_tabBarItemEnabledContext == context && [keyPath isEqual:NSStringFromSelector(@selector(isEnabled))]) {
         BOOL const isButtonEnabled = [(NSNumber *)newValue boolValue];
         [horizontalTabBar _setButtonEnabled:isButtonEnabled atIndex:verticalTabBarButtonIndex];
@@ -463,6 +769,11 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
 - (void)tabBar:(TBTabBar *)tabBar didSelectItem:(TBTabBarItem *)item atIndex:(NSUInteger)index {
 
+    if (tbtbbrcntrlr_eventDepth == 0) {
+        // A tap, a selection made through the controller has already been recorded
+        [_eventRecorder recordEvent:TBTabBarControllerEventTypeSelectItem firstArgument:index secondArgument:0];
+    }
+
     if (_delegateFlags.didSelectItemAtIndex) {
         [self.delegate tabBarController:self didSelectItem:item atIndex:index];
     }
@@ -501,6 +812,22 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     }
 }
 
+- (void)tabBar:(TBTabBar *)tabBar didMoveItem:(TBTabBarItem *)item fromIndex:(NSUInteger)sourceIndex toIndex:(NSUInteger)destinationIndex {
+
+    // The item takes the place of the tab it was dropped onto, which is now next to it
+
+    TBTabBarItem *neighbourItem = tabBar.visibleItems[sourceIndex < destinationIndex ? destinationIndex - 1 : destinationIndex + 1];
+
+    NSUInteger const index = [_items indexOfObjectIdenticalTo:item];
+    NSUInteger const newIndex = [_items indexOfObjectIdenticalTo:neighbourItem];
+
+    if (index == NSNotFound || newIndex == NSNotFound) {
+        return;
+    }
+
+    [self moveItemAtIndex:index toIndex:newIndex];
+}
+
 #pragma mark Private Methods
 
 #pragma mark Setup
@@ -511,6 +838,8 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     _startingIndex = 0;
     _horizontalTabBarHeight = 49.0;
     _verticalTabBarWidth = 60.0;
+    _liveResizeSettleInterval = 0.15;
+    _selectionHistory = [[TBTabBarSelectionHistory alloc] init];
 }
 
 - (void)tbtbbrcntrlr_setup {
@@ -536,6 +865,8 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
 - (void)tbtbbrcntrlr_beginTabBarTransition {
 
+    [_hitchMonitor beginPhase:TBTabBarHitchPhaseTabBarTransition];
+
     tbtbbrcntrlr_isTransitioning = true;
 
     if (_preferredPlacement == _currentPlacement ||
@@ -597,12 +928,22 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     }
 
     [self tbtbbrcntrlr_showTabBarIfNeeded:hiddenTabBar tabBarToHide:visibleTabBar];
-    [self tbtbbrcntrlr_updateAdditionalSafeAreaInsets:tbtbbrcntrlr_selectedViewControllerNeedsLayout];
 
+    _TBTabBarControllerPlacementLayout const layout = [self tbtbbrcntrlr_placementLayoutForBounds:self.view.bounds];
+
+    [self tbtbbrcntrlr_applyPlacementLayout:layout];
+    [self tbtbbrcntrlr_updateAdditionalSafeAreaInsets:layout.additionalSafeAreaInsets];
+
+    // The next pass only catches up with the safe area of the view, the frames are already in place
     tbtbbrcntrlr_needsLayout = true;
 
     [self.view setNeedsLayout];
-    [self.view layoutIfNeeded];
+
+    if ([UIView inheritedAnimationDuration] > 0.0) {
+        // We are inside of an animation block, so the whole hierarchy (including the selected view controller)
+        // has to catch up with the new frames and insets right now to be animated alongside
+        [self.view layoutIfNeeded];
+    }
 }
 
 - (void)tbtbbrcntrlr_endTabBarTransition {
@@ -610,6 +951,8 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     if (!tbtbbrcntrlr_needsUpdateTabBarPlacement) {
         _preferredPlacement = TBTabBarControllerTabBarPlacementUndefined;
         tbtbbrcntrlr_isTransitioning = false;
+        [_hitchMonitor endPhase:TBTabBarHitchPhaseTabBarTransition];
+        [self tbtbbrcntrlr_settleDeferredLiveResizeIfNeeded];
         return;
     }
 
@@ -643,45 +986,33 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
     [self tbtbbrcntrlr_hideTabBarIfNeeded:visibleTabBar tabBarToShow:hiddenTabBar];
 
-    tbtbbrcntrlr_needsLayout = true;
     tbtbbrcntrlr_needsUpdateTabBarPlacement = false;
     tbtbbrcntrlr_isTransitioning = false;
 
+    [self tbtbbrcntrlr_applyPlacementLayout:[self tbtbbrcntrlr_placementLayoutForBounds:self.view.bounds]];
+
+    tbtbbrcntrlr_needsLayout = true;
+
     [self.view setNeedsLayout];
-    [self.view layoutIfNeeded];
 
     _preferredPlacement = TBTabBarControllerTabBarPlacementUndefined;
-}
 
+    [_hitchMonitor endPhase:TBTabBarHitchPhaseTabBarTransition];
 
-- (void)tbtbbrcntrlr_updateAdditionalSafeAreaInsets:(BOOL)shouldLayoutManually {
+    [self tbtbbrcntrlr_settleDeferredLiveResizeIfNeeded];
+}
 
-    UIViewController *selectedViewController = self.selectedViewController;
-    UIEdgeInsets additionalSafeAreaInsets = UIEdgeInsetsZero;
 
-    switch (_preferredPlacement) {
-        case TBTabBarControllerTabBarPlacementLeading:
-            additionalSafeAreaInsets = UIEdgeInsetsMake(0.0, self.verticalTabBarWidth, 0.0, 0.0);
-            break;
-
-        case TBTabBarControllerTabBarPlacementTrailing:
-            additionalSafeAreaInsets = UIEdgeInsetsMake(0.0, 0.0, 0.0, self.verticalTabBarWidth);
-            break;
+- (void)tbtbbrcntrlr_updateAdditionalSafeAreaInsets:(UIEdgeInsets)additionalSafeAreaInsets {
 
-        case TBTabBarControllerTabBarPlacementBottom:
-            additionalSafeAreaInsets = UIEdgeInsetsMake(0.0, 0.0, self.horizontalTabBarHeight, 0.0);
-            break;
+    UIViewController *selectedViewController = self.selectedViewController;
 
-        default:
-            break;
+    if (UIEdgeInsetsEqualToEdgeInsets(selectedViewController.additionalSafeAreaInsets, additionalSafeAreaInsets)) {
+        return;
     }
 
+    // Invalidates the layout of the selected view controller, the pass itself is left to whoever owns the current animation
     selectedViewController.additionalSafeAreaInsets = additionalSafeAreaInsets;
-
-    if (shouldLayoutManually) {
-        [selectedViewController.view setNeedsLayout];
-        [selectedViewController.view layoutIfNeeded];
-    }
 }
 
 - (void)tbtbbrcntrlr_showTabBarIfNeeded:(nullable TBTabBar *)tabBarToShow
@@ -798,6 +1129,100 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     }
 }
 
+#pragma mark Live resize
+
+- (TBTabBarControllerTabBarPlacement)tbtbbrcntrlr_thresholdPlacementForSize:(CGSize)size {
+
+    if (tbtbbrcntrlr_methodOverridesFlag & _TBTabBarControllerMethodOverridePreferredTabBarPlacementForViewSize) {
+        return [self preferredTabBarPlacementForViewSize:size];
+    }
+
+    // Without the override, only a change of the horizontal size class can change the placement
+    return TBTabBarControllerTabBarPlacementUndefined;
+}
+
+- (BOOL)tbtbbrcntrlr_crossesPlacementThresholdForSize:(CGSize)size {
+
+    return tbtbbrcntrlr_isChangingHorizontalSizeClass ||
+           [self tbtbbrcntrlr_thresholdPlacementForSize:size] != tbtbbrcntrlr_liveResizeThresholdPlacement;
+}
+
+- (void)tbtbbrcntrlr_continueLiveResize {
+
+    _liveResizing = true;
+
+    // Still dragging, so a transition that ends now has nothing to settle
+    tbtbbrcntrlr_needsSettleLiveResize = false;
+
+    // The bars are moved to their new frames in the next layout pass, nothing is laid out right away
+    tbtbbrcntrlr_needsLayout = true;
+
+    [self.view setNeedsLayout];
+
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(tbtbbrcntrlr_settleLiveResize) object:nil];
+    [self performSelector:@selector(tbtbbrcntrlr_settleLiveResize) withObject:nil afterDelay:_liveResizeSettleInterval];
+}
+
+- (void)tbtbbrcntrlr_settleLiveResize {
+
+    [self tbtbbrcntrlr_settleLiveResizeAnimated:self.view.window != nil];
+}
+
+- (void)tbtbbrcntrlr_settleLiveResizeAnimated:(BOOL)animated {
+
+    if (!_liveResizing) {
+        return;
+    }
+
+    if (tbtbbrcntrlr_isTransitioning) {
+        // The transition of the last threshold crossing settles the resize once it ends
+        tbtbbrcntrlr_needsSettleLiveResize = true;
+        return;
+    }
+
+    _liveResizing = false;
+    tbtbbrcntrlr_needsSettleLiveResize = false;
+
+    CGSize const size = self.view.bounds.size;
+
+    tbtbbrcntrlr_isChangingHorizontalSizeClass = false;
+    tbtbbrcntrlr_liveResizeThresholdPlacement = [self tbtbbrcntrlr_thresholdPlacementForSize:size];
+
+    [self _specifyPreferredTabBarPlacementForHorizontalSizeClass:self.traitCollection.horizontalSizeClass size:size];
+
+    [self tbtbbrcntrlr_adjustVerticalTabBarHeightIfNeeded];
+
+    [self tbtbbrcntrlr_ensureVerticalTabBarPlacedAtRightLocationBeforeTransition];
+
+    if (!animated) {
+        [UIView performWithoutAnimation:^{
+            [self beginTabBarTransition];
+            [self endTabBarTransition];
+        }];
+        return;
+    }
+
+    __weak typeof(self) weakSelf = self;
+
+    [UIView animateWithDuration:_TBTabBarControllerLiveResizeSettleAnimationDuration animations:^{
+        [weakSelf beginTabBarTransition];
+    } completion:^(BOOL finished) {
+        [weakSelf endTabBarTransition];
+    }];
+}
+
+- (void)tbtbbrcntrlr_settleDeferredLiveResizeIfNeeded {
+
+    if (!tbtbbrcntrlr_needsSettleLiveResize) {
+        return;
+    }
+
+    tbtbbrcntrlr_needsSettleLiveResize = false;
+
+    // Not from within the transition that has just ended
+    [self performSelector:@selector(tbtbbrcntrlr_settleLiveResize) withObject:nil afterDelay:0.0];
+}
+
 #pragma mark Layout
 
 - (void)tbtbbrcntrlr_layoutBars {
@@ -808,81 +1233,114 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
     tbtbbrcntrlr_needsLayout = false;
 
-    if (_preferredPlacement != TBTabBarControllerTabBarPlacementUndefined) {
+    [_hitchMonitor beginPhase:TBTabBarHitchPhaseBarLayout];
 
-        TBTabBar *hTabBar = self.horizontalTabBar;
-        TBTabBar *vTabBar = self.verticalTabBar;
+    [self tbtbbrcntrlr_applyPlacementLayout:[self tbtbbrcntrlr_placementLayoutForBounds:self.view.bounds]];
 
-        switch (_preferredPlacement) {
-            case TBTabBarControllerTabBarPlacementHidden:
-                [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:true];
-                break;
+    [_hitchMonitor endPhase:TBTabBarHitchPhaseBarLayout];
+}
 
-            case TBTabBarControllerTabBarPlacementLeading:
-            case TBTabBarControllerTabBarPlacementTrailing:
-                switch (_currentPlacement) {
-                    case TBTabBarControllerTabBarPlacementHidden:
-                        [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:false];
-                        break;
+- (_TBTabBarControllerPlacementLayout)tbtbbrcntrlr_placementLayoutForBounds:(CGRect)bounds {
 
-                    case TBTabBarControllerTabBarPlacementLeading:
-                    case TBTabBarControllerTabBarPlacementTrailing:
-                        [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:false];
-                        break;
+    BOOL hBarHidden = true, vBarHidden = true, extendsVerticalTabBar = false;
 
-                    case TBTabBarControllerTabBarPlacementBottom:
+    TBTabBarControllerTabBarPlacement const placement = _preferredPlacement != TBTabBarControllerTabBarPlacementUndefined ? _preferredPlacement : _currentPlacement;
 
-                        [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:false];
+    switch (placement) {
+        case TBTabBarControllerTabBarPlacementLeading:
+        case TBTabBarControllerTabBarPlacementTrailing:
+            vBarHidden = false;
+            // The vertical tab bar covers the space of the horizontal one while the latter is sliding away
+            extendsVerticalTabBar = tbtbbrcntrlr_isTransitioning &&
+                                    _preferredPlacement != TBTabBarControllerTabBarPlacementUndefined &&
+                                    _currentPlacement == TBTabBarControllerTabBarPlacementBottom;
+            break;
 
-                        if (tbtbbrcntrlr_isTransitioning) {
-                            CGRect vTabBarFrame = vTabBar.frame;
-                            vTabBarFrame.size.height += hTabBar.frame.size.height;
-                            vTabBar.frame = vTabBarFrame;
-                        }
+        case TBTabBarControllerTabBarPlacementBottom:
+            hBarHidden = false;
+            break;
 
-                        break;
+        default:
+            break;
+    }
 
-                    default:
-                        break;
-                }
-                break;
+    _TBTabBarControllerPlacementLayout layout;
 
-            case TBTabBarControllerTabBarPlacementBottom:
-                [self tbtbbrcntrlr_layoutBarsHBarHidden:false vBarHidden:true];
+    layout.horizontalTabBarFrame = [self tbtbbrcntrlr_horizontalTabBarFrame:bounds hidden:hBarHidden];
+    layout.verticalTabBarFrame = [self tbtbbrcntrlr_verticalTabBarFrame:bounds hidden:vBarHidden];
+    layout.dummyBarFrame = [self tbtbbrcntrlr_dummyBarFrame:bounds hidden:vBarHidden];
+    layout.additionalSafeAreaInsets = [self tbtbbrcntrlr_additionalSafeAreaInsetsForPlacement:_preferredPlacement];
 
-            default:
-                break;
-        }
+    if (extendsVerticalTabBar) {
+        layout.verticalTabBarFrame.size.height += CGRectGetHeight(self.horizontalTabBar.frame);
+    }
 
-    } else if (_currentPlacement != TBTabBarControllerTabBarPlacementUndefined) {
+    return layout;
+}
 
-        switch (_currentPlacement) {
-            case TBTabBarControllerTabBarPlacementHidden:
-                [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:true];
-                break;
+- (void)tbtbbrcntrlr_applyPlacementLayout:(_TBTabBarControllerPlacementLayout)layout {
 
-            case TBTabBarControllerTabBarPlacementLeading:
-            case TBTabBarControllerTabBarPlacementTrailing:
-                [self tbtbbrcntrlr_layoutBarsHBarHidden:true vBarHidden:false];
-                break;
+    // Only the frames are set here, the bars lay themselves out on the next pass
+    TBTabBar *horizontalTabBar = self.horizontalTabBar;
+    TBTabBar *verticalTabBar = self.verticalTabBar;
+    TBDummyBar *dummyBar = self.dummyBar;
 
-            case TBTabBarControllerTabBarPlacementBottom:
-                [self tbtbbrcntrlr_layoutBarsHBarHidden:false vBarHidden:true];
-                break;
+    if (!CGRectEqualToRect(horizontalTabBar.frame, layout.horizontalTabBarFrame)) {
+        horizontalTabBar.frame = layout.horizontalTabBarFrame;
+    }
 
-            default:
-                break;
-        }
+    if (!CGRectEqualToRect(verticalTabBar.frame, layout.verticalTabBarFrame)) {
+        verticalTabBar.frame = layout.verticalTabBarFrame;
+    }
+
+    if (!CGRectEqualToRect(dummyBar.frame, layout.dummyBarFrame)) {
+        dummyBar.frame = layout.dummyBarFrame;
     }
 }
 
-- (void)tbtbbrcntrlr_layoutBarsHBarHidden:(BOOL)hBarHidden vBarHidden:(BOOL)vBarHidden {
+- (UIEdgeInsets)tbtbbrcntrlr_additionalSafeAreaInsetsForPlacement:(TBTabBarControllerTabBarPlacement)placement {
 
-    CGRect const bounds = self.view.bounds;
+    switch (placement) {
+        case TBTabBarControllerTabBarPlacementLeading:
+            return UIEdgeInsetsMake(0.0, self.verticalTabBarWidth, 0.0, 0.0);
+
+        case TBTabBarControllerTabBarPlacementTrailing:
+            return UIEdgeInsetsMake(0.0, 0.0, 0.0, self.verticalTabBarWidth);
+
+        case TBTabBarControllerTabBarPlacementBottom:
+            return UIEdgeInsetsMake(0.0, 0.0, self.horizontalTabBarHeight, 0.0);
+
+        default:
+            return UIEdgeInsetsZero;
+    }
+}
+
+- (void)tbtbbrcntrlr_translateView:(UIView *)view toOrigin:(CGFloat)origin horizontally:(BOOL)horizontally {
+
+    // The center and the bounds are not affected by the transform, unlike the frame
+    CGPoint const center = view.center;
+    CGSize const size = view.bounds.size;
+
+    if (horizontally) {
+        view.transform = CGAffineTransformMakeTranslation(origin - (center.x - (size.width / 2.0)), 0.0);
+    } else {
+        view.transform = CGAffineTransformMakeTranslation(0.0, origin - (center.y - (size.height / 2.0)));
+    }
+}
+
+- (void)tbtbbrcntrlr_resetInteractiveTranslation {
+
+    TBTabBar *tabBar = tbtbbrcntrlr_transitionState.manipulatedTabBar;
+
+    if (tabBar != nil && !CGAffineTransformIsIdentity(tabBar.transform)) {
+        tabBar.transform = CGAffineTransformIdentity;
+    }
 
-    self.horizontalTabBar.frame = [self tbtbbrcntrlr_horizontalTabBarFrame:bounds hidden:hBarHidden];
-    self.verticalTabBar.frame = [self tbtbbrcntrlr_verticalTabBarFrame:bounds hidden:vBarHidden];
-    self.dummyBar.frame = [self tbtbbrcntrlr_dummyBarFrame:bounds hidden:vBarHidden];
+    TBDummyBar *dummyBar = self.dummyBar;
+
+    if (!CGAffineTransformIsIdentity(dummyBar.transform)) {
+        dummyBar.transform = CGAffineTransformIdentity;
+    }
 }
 
 - (CGRect)tbtbbrcntrlr_horizontalTabBarFrame:(CGRect)bounds hidden:(BOOL)hidden {
@@ -953,13 +1411,10 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
     tabBar.frame = [self tbtbbrcntrlr_verticalTabBarFrame:self.view.bounds hidden:!tabBar.isVisible];
 
     [tabBar _prepareForTransitionToPlacement:_preferredPlacement];
-    [tabBar layoutIfNeeded];
 
     TBDummyBar *dummyBar = self.dummyBar;
     dummyBar.frame = [self tbtbbrcntrlr_dummyBarFrame:self.view.bounds hidden:!tabBar.isVisible];
     dummyBar.separatorPosition = tabBar.separatorPosition;
-
-    [dummyBar layoutIfNeeded];
 }
 
 - (void)tbtbbrcntrlr_adjustVerticalTabBarHeightIfNeeded {
@@ -993,6 +1448,12 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
 
     _selectedViewController = destinationViewController;
 
+    if (tbtbbrcntrlr_isSelectingPreviousTab && destinationViewController.tb_tabBarItem == _selectionHistory.previousItem) {
+        [_selectionHistory popItem];
+    } else {
+        [_selectionHistory pushItem:destinationViewController.tb_tabBarItem];
+    }
+
     [self tbtbbrcntrlr_captureNestedNavigationControllerIfExists];
 
     [self tbtbbrcntrlr_cycleFromSourceViewController:sourceViewController
@@ -1021,7 +1482,12 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
                                         typeof(self) strongSelf = weakSelf;
 
                                         strongSelf->_selectedViewController = nil;
-                                        strongSelf->tbtbbrcntrlr_nestedNavigationController = nil;
+
+                                        UINavigationController *nestedNavigationController = strongSelf->tbtbbrcntrlr_nestedNavigationController;
+
+                                        if (nestedNavigationController != nil) {
+                                            [strongSelf unregisterNavigationController:nestedNavigationController];
+                                        }
                                     }];
 }
 
@@ -1029,6 +1495,11 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
                        toDestinationViewController:(nullable UIViewController *)destinationViewController
                                    completionBlock:(nullable void(^)(void))completionBlock {
 
+    // The phase ends on the monitor it began on, even if the monitor is replaced in the meantime
+    TBTabBarHitchMonitor *hitchMonitor = _hitchMonitor;
+
+    [hitchMonitor beginPhase:TBTabBarHitchPhaseTabTransition];
+
     [sourceViewController willMoveToParentViewController:nil];
 
     if (destinationViewController != nil) {
@@ -1036,6 +1507,8 @@ static _TBTabBarControllerMethodOverrides tbtbbrcntrlr_methodOverridesFlag;
         [self addChildViewController:destinationViewController];
     }
 
+    [TBTabBarController _invalidateCachedTabBarControllers];
+
     __weak typeof(self) weakSelf = self;
 
     id<UIViewControllerAnimatedTransitioning> animator;
@@ -1064,6 +1537,8 @@ animationControllerForTransitionFromViewController:sourceViewController
         if (completionBlock != nil) {
             completionBlock();
         }
+
+        [hitchMonitor endPhase:TBTabBarHitchPhaseTabTransition];
     };
 
     [animator animateTransition:transitionContext];
@@ -1109,6 +1584,11 @@ animationControllerForTransitionFromViewController:sourceViewController
            forKeyPath:NSStringFromSelector(@selector(isEnabled))
               options:NSKeyValueObservingOptionNew
               context:tbtbbrcntrlr_tabBarItemEnabledContext];
+
+    [item addObserver:self
+           forKeyPath:NSStringFromSelector(@selector(badgeValue))
+              options:NSKeyValueObservingOptionNew
+              context:tbtbbrcntrlr_tabBarItemBadgeValueContext];
 }
 
 - (void)tbtbbrcntrlr_removeItemObservers {
@@ -1143,10 +1623,61 @@ animationControllerForTransitionFromViewController:sourceViewController
     [item removeObserver:self
               forKeyPath:NSStringFromSelector(@selector(isEnabled))
                  context:tbtbbrcntrlr_tabBarItemEnabledContext];
+
+    [item removeObserver:self
+              forKeyPath:NSStringFromSelector(@selector(badgeValue))
+                 context:tbtbbrcntrlr_tabBarItemBadgeValueContext];
 }
 
 #pragma mark Helpers
 
+- (void)tbtbbrcntrlr_beginEvent:(TBTabBarControllerEventType)type firstArgument:(NSUInteger)firstArgument secondArgument:(NSUInteger)secondArgument {
+
+    // Public methods call each other and go through the tab bar delegate methods, only the outermost call is what the caller did
+    if (tbtbbrcntrlr_eventDepth == 0) {
+        [_eventRecorder recordEvent:type firstArgument:firstArgument secondArgument:secondArgument];
+    }
+
+    tbtbbrcntrlr_eventDepth += 1;
+}
+
+- (void)tbtbbrcntrlr_endEvent {
+
+    tbtbbrcntrlr_eventDepth -= 1;
+}
+
+- (void)tbtbbrcntrlr_recordChangeOfItem:(TBTabBarItem *)item context:(void *)context {
+
+    if (tbtbbrcntrlr_eventDepth > 0) {
+        // Replaying the event in flight makes the same change
+        return;
+    }
+
+    TBTabBarControllerEventItemProperty property;
+
+    if (context == tbtbbrcntrlr_tabBarItemImageContext) {
+        property = TBTabBarControllerEventItemPropertyImage;
+    } else if (context == tbtbbrcntrlr_tabBarItemSelectedImageContext) {
+        property = TBTabBarControllerEventItemPropertySelectedImage;
+    } else if (context == tbtbbrcntrlr_tabBarItemNotificationIndicatorContext) {
+        property = TBTabBarControllerEventItemPropertyNotificationIndicator;
+    } else if (context == tbtbbrcntrlr_tabBarItemShowsNotificationIndicatorContext) {
+        property = TBTabBarControllerEventItemPropertyShowsNotificationIndicator;
+    } else if (context == tbtbbrcntrlr_tabBarItemBadgeValueContext) {
+        property = TBTabBarControllerEventItemPropertyBadgeValue;
+    } else if (context == tbtbbrcntrlr_tabBarItemEnabledContext) {
+        property = TBTabBarControllerEventItemPropertyEnabled;
+    } else {
+        return;
+    }
+
+    NSUInteger const index = [_items indexOfObjectIdenticalTo:item];
+
+    if (index != NSNotFound) {
+        [_eventRecorder recordEvent:TBTabBarControllerEventTypeChangeItem firstArgument:index secondArgument:property];
+    }
+}
+
 - (void)tbtbbrcntrlr_specifyPreferredPlacementForSizeClass:(UIUserInterfaceSizeClass)horizontalSizeClass {
 
     if (_preferredPlacement == TBTabBarControllerTabBarPlacementUndefined) {
@@ -1167,14 +1698,21 @@ animationControllerForTransitionFromViewController:sourceViewController
     // https://github.com/TimOliver/TOTabBarController
 
     UIViewController *viewController = _selectedViewController;
+    UINavigationController *navigationController;
 
     do {
         if ([viewController isKindOfClass:[UINavigationController class]]) {
-            tbtbbrcntrlr_nestedNavigationController = (UINavigationController *)viewController;
+            navigationController = (UINavigationController *)viewController;
             break;
         }
     } while ((viewController = viewController.childViewControllers.firstObject));
 
+    if (navigationController != nil) {
+        [self registerNavigationController:navigationController];
+    } else if (tbtbbrcntrlr_nestedNavigationController != nil) {
+        [self unregisterNavigationController:tbtbbrcntrlr_nestedNavigationController];
+    }
+
     switch (_currentPlacement) {
         case TBTabBarControllerTabBarPlacementLeading:
             tbtbbrcntrlr_nestedNavigationController.additionalSafeAreaInsets = UIEdgeInsetsMake(0.0, self.verticalTabBarWidth, 0.0, 0.0);
@@ -1193,26 +1731,83 @@ animationControllerForTransitionFromViewController:sourceViewController
     }
 }
 
-- (void)tbtbbrcntrlr_processViewControllersWithValue:(id)value {
+- (void)tbtbbrcntrlr_setOwner:(nullable TBTabBarController *)owner forViewControllers:(NSArray<__kindof UIViewController *> *)viewControllers {
 
-    for (UIViewController *viewController in self.viewControllers) {
-        [self tbtbbrcntrlr_processViewControllerChildren:viewController withValue:value];
+    for (UIViewController *viewController in viewControllers) {
+        _TBTabBarControllerReference *reference = owner != nil ? [[_TBTabBarControllerReference alloc] initWithTabBarController:owner] : nil;
+        objc_setAssociatedObject(viewController, &_tabBarControllerOwnerKey, reference, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
     }
+
+    [TBTabBarController _invalidateCachedTabBarControllers];
+}
+
+- (void)tbtbbrcntrlr_captureItems {
+
+    _items = [[self.viewControllers valueForKeyPath:[NSString stringWithFormat:@"@unionOfObjects.%@", NSStringFromSelector(@selector(tb_tabBarItem))]] mutableCopy];
 }
 
-- (void)tbtbbrcntrlr_processViewControllerChildren:(__kindof UIViewController *)viewController
-                                         withValue:(id)value {
+- (void)tbtbbrcntrlr_selectFirstSelectableViewController {
 
-    for (UIViewController *childViewController in viewController.childViewControllers) {
-        [self tbtbbrcntrlr_processViewControllerChildren:childViewController withValue:value];
+    NSArray<UIViewController *> *viewControllers = self.viewControllers;
+
+    if (viewControllers.count == 0) {
+        return;
     }
 
-    [viewController setValue:value forKey:NSStringFromSelector(@selector(tb_tabBarController))];
+    UIViewController *viewControllerToSelect;
+
+    if (_delegateFlags.shouldSelectItemAtIndex) {
+        for (UIViewController *viewController in viewControllers) {
+            if ([self.delegate tabBarController:self shouldSelectViewController:viewController]) {
+                viewControllerToSelect = viewController;
+                break;
+            }
+        }
+    } else {
+        viewControllerToSelect = viewControllers.firstObject;
+    }
+
+    if (viewControllerToSelect == nil) {
+        return;
+    }
+
+    NSUInteger const viewControllerIndexToSelect = [viewControllers indexOfObject:viewControllerToSelect];
+
+    [self tbtbbrcntrlr_moveToViewControllerAtIndex:viewControllerIndexToSelect];
+    [self tbtbbrcntrlr_updateTabBarsSelection];
+
+    if (_delegateFlags.didSelectViewController) {
+        [self.delegate tabBarController:self didSelectViewController:viewControllerToSelect];
+    }
 }
 
-- (void)tbtbbrcntrlr_captureItems {
+- (void)tbtbbrcntrlr_updateTabBarsSelection {
+
+    TBTabBarItem *selectedItem = _selectedViewController.tb_tabBarItem;
+
+    for (TBTabBar *tabBar in @[self.horizontalTabBar, self.verticalTabBar]) {
+        NSUInteger const index = selectedItem != nil ? [tabBar.visibleItems indexOfObjectIdenticalTo:selectedItem] : NSNotFound;
+        if (index != NSNotFound) {
+            [tabBar _setSelectedIndex:index quietly:true];
+        } else {
+            [tabBar _deselect];
+        }
+    }
+}
+
+- (void)tbtbbrcntrlr_forgetItemsMissingFromSelectionHistory {
+
+    NSHashTable<TBTabBarItem *> *items = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+
+    for (TBTabBarItem *item in _items) {
+        [items addObject:item];
+    }
 
-    _items = [self.viewControllers valueForKeyPath:[NSString stringWithFormat:@"@unionOfObjects.%@", NSStringFromSelector(@selector(tb_tabBarItem))]];
+    for (TBTabBarItem *item in _selectionHistory.mostUsedItems) {
+        if (![items containsObject:item]) {
+            [_selectionHistory removeItem:item];
+        }
+    }
 }
 
 - (void)tbtbbrcntrlr_handleItemSelectionAtIndex:(NSUInteger)index {
@@ -1324,9 +1919,11 @@ animationControllerForTransitionFromViewController:sourceViewController
 
 - (void)setViewControllers:(NSArray <__kindof UIViewController *> *)viewControllers {
 
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeSetViewControllers firstArgument:viewControllers.count secondArgument:0];
+
     if (_viewControllers != nil && _viewControllers.count > 0) {
         [self tbtbbrcntrlr_removeItemObservers];
-        [self tbtbbrcntrlr_processViewControllersWithValue:nil];
+        [self tbtbbrcntrlr_setOwner:nil forViewControllers:_viewControllers];
         [_items removeAllObjects];
     }
 
@@ -1334,21 +1931,29 @@ animationControllerForTransitionFromViewController:sourceViewController
         _viewControllers = [viewControllers copy];
         [self tbtbbrcntrlr_captureItems];
         [self tbtbbrcntrlr_observeItems];
-        [self tbtbbrcntrlr_processViewControllersWithValue:self];
+        [self tbtbbrcntrlr_setOwner:self forViewControllers:_viewControllers];
+        [self tbtbbrcntrlr_forgetItemsMissingFromSelectionHistory];
     } else {
         _viewControllers = nil;
         [self tbtbbrcntrlr_clearHierarchy];
+        [_selectionHistory removeAllItems];
     }
 
     [self.horizontalTabBar _setItems:_items];
     [self.verticalTabBar _setItems:_items];
+
+    [self tbtbbrcntrlr_endEvent];
 }
 
 - (void)setSelectedIndex:(NSUInteger)selectedIndex {
 
+    [self tbtbbrcntrlr_beginEvent:TBTabBarControllerEventTypeSelectItem firstArgument:selectedIndex secondArgument:0];
+
     _selectedIndex = selectedIndex;
 
     [self tbtbbrcntrlr_handleItemSelectionAtIndex:selectedIndex];
+
+    [self tbtbbrcntrlr_endEvent];
 }
 
 - (void)setVerticalTabBarWidth:(CGFloat)verticalTabBarWidth {
@@ -1446,7 +2051,41 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
 
 - (TBTabBarController *)tb_tabBarController {
 
-    return objc_getAssociatedObject(self, &_tabBarControllerPropertyKey);
+    _TBTabBarControllerReference *reference = objc_getAssociatedObject(self, &_tabBarControllerPropertyKey);
+
+    if (reference != nil && reference.generation == tbtbbrcntrlr_hierarchyGeneration) {
+        return reference.tabBarController;
+    }
+
+    TBTabBarController *tabBarController;
+    UIViewController *viewController = self;
+    UIViewController *parentViewController;
+
+    while ((parentViewController = viewController.parentViewController) != nil) {
+        if ([parentViewController isKindOfClass:[TBTabBarController class]]) {
+            tabBarController = (TBTabBarController *)parentViewController;
+            break;
+        }
+        viewController = parentViewController;
+    }
+
+    if (tabBarController == nil) {
+        // The view controllers of the tabs that are not selected are not in the hierarchy of the tab bar controller,
+        // so the root view controller remembers which tab bar controller owns it
+        _TBTabBarControllerReference *ownerReference = objc_getAssociatedObject(viewController, &_tabBarControllerOwnerKey);
+        tabBarController = ownerReference.tabBarController;
+    }
+
+    // A view controller that is not in a tab yet may be added to one without the generation being bumped
+    // (e.g. pushed onto a navigation controller that is not integrated), so misses are looked up again
+    if (tabBarController != nil) {
+        objc_setAssociatedObject(self,
+                                 &_tabBarControllerPropertyKey,
+                                 [[_TBTabBarControllerReference alloc] initWithTabBarController:tabBarController],
+                                 OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+
+    return tabBarController;
 }
 
 - (BOOL)tb_hidesTabBarWhenPushed {
@@ -1491,14 +2130,6 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
                              OBJC_ASSOCIATION_RETAIN_NONATOMIC);
 }
 
-- (void)setTb_tabBarController:(TBTabBarController * _Nullable)tb_tabBarController {
-
-    objc_setAssociatedObject(self,
-                             &_tabBarControllerPropertyKey,
-                             tb_tabBarController,
-                             OBJC_ASSOCIATION_ASSIGN);
-}
-
 - (void)tb_setHidesTabBarWhenPushed:(BOOL)_hidesTabBarWhenPushed {
 
     objc_setAssociatedObject(self,
@@ -1513,6 +2144,11 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
 
 @implementation TBTabBarController (Private)
 
++ (void)_invalidateCachedTabBarControllers {
+
+    tbtbbrcntrlr_hierarchyGeneration += 1;
+}
+
 - (void)_specifyPreferredTabBarPlacementForHorizontalSizeClass:(UIUserInterfaceSizeClass)horizontalSizeClass
                                                          size:(CGSize)size {
 
@@ -1655,29 +2291,25 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
         return;
     }
 
+    // The bars are moved with a transform, so neither of them is invalidated at touch rate.
+    // The real frames are committed in the `willEndTransition` callback.
     if (tabBar.isVertical) {
         CGFloat const tabBarWidth = self.verticalTabBarWidth + self.view.safeAreaInsets.left;
-        CGRect frame = tabBar.frame;
         if (tbtbbrcntrlr_transitionState.isShowing) {
             CGFloat const offset = -(tabBarWidth * MAX(0.0, (1.0 - percentComplete)));
-            frame.origin.x = offset;
-            tabBar.frame = frame;
-            CGRect dummyBarFrame = self.dummyBar.frame;
-            dummyBarFrame.origin.x = offset;
-            self.dummyBar.frame = dummyBarFrame;
+            [self tbtbbrcntrlr_translateView:tabBar toOrigin:offset horizontally:true];
+            [self tbtbbrcntrlr_translateView:self.dummyBar toOrigin:offset horizontally:true];
         } else if (tbtbbrcntrlr_transitionState.isHiding) {
-            frame.origin.x = -(tabBarWidth * percentComplete);
-            tabBar.frame = frame;
+            [self tbtbbrcntrlr_translateView:tabBar toOrigin:-(tabBarWidth * percentComplete) horizontally:true];
         }
     } else {
         CGFloat const tabBarHeight = self.horizontalTabBarHeight + self.view.safeAreaInsets.bottom;
-        CGRect frame = tabBar.frame;
         if (tbtbbrcntrlr_transitionState.isShowing) {
-            frame.origin.y = CGRectGetHeight(self.view.bounds) - (tabBarHeight * percentComplete);
-            tabBar.frame = frame;
+            CGFloat const origin = CGRectGetHeight(self.view.bounds) - (tabBarHeight * percentComplete);
+            [self tbtbbrcntrlr_translateView:tabBar toOrigin:origin horizontally:false];
         } else if (tbtbbrcntrlr_transitionState.isHiding) {
-            frame.origin.y = CGRectGetHeight(self.view.bounds) - (tabBarHeight * MAX(0.0, (1.0 - percentComplete)));
-            tabBar.frame = frame;
+            CGFloat const origin = CGRectGetHeight(self.view.bounds) - (tabBarHeight * MAX(0.0, (1.0 - percentComplete)));
+            [self tbtbbrcntrlr_translateView:tabBar toOrigin:origin horizontally:false];
         }
     }
 }
@@ -1701,6 +2333,8 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
 
     _visibleViewControllerWantsHideTabBar = visibleViewController.tb_hidesTabBarWhenPushed;
 
+    // Dropping the interactive offsets here animates the bars from where the user left them to their final frames
+    [self tbtbbrcntrlr_resetInteractiveTranslation];
     [self tbtbbrcntrlr_beginTabBarTransition];
 }
 
@@ -1709,6 +2343,7 @@ static char *_tabBarControllerCategoryHidesTabBarWhenPushedKey;
                              to:(UIViewController *)destinationViewController
                       cancelled:(BOOL)cancelled {
 
+    [self tbtbbrcntrlr_resetInteractiveTranslation];
     [self tbtbbrcntrlr_endTabBarTransition];
 
     tbtbbrcntrlr_transitionState = nil;
@@ -0,0 +1,400 @@
+//
+//  TBTabBarControllerEventTrace.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarControllerEventTrace.h"
+#import "TBTabBarController.h"
+#import "TBTabBarItem.h"
+#import "TBTabBarButton.h"
+
+#import <malloc/malloc.h>
+
+NSErrorDomain const TBTabBarControllerEventTraceErrorDomain = @"TBTabBarControllerEventTraceErrorDomain";
+
+static uint8_t const _TBEventTraceMagic[4] = {'T', 'B', 'T', 'R'};
+static uint8_t const _TBEventTraceVersion = 1;
+static NSUInteger const _TBEventTraceHeaderLength = sizeof(_TBEventTraceMagic) + sizeof(_TBEventTraceVersion);
+
+/// Writes a value in the LEB128 format and returns the number of bytes written (10 at most)
+static inline NSUInteger _TBEventTraceWriteVarint(uint8_t *buffer, uint64_t value) {
+
+    NSUInteger length = 0;
+
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        buffer[length++] = byte;
+    } while (value != 0);
+
+    return length;
+}
+
+/// Reads a value in the LEB128 format, returns `false` if the buffer ends in the middle of the value
+static inline BOOL _TBEventTraceReadVarint(const uint8_t *bytes, NSUInteger length, NSUInteger *offset, uint64_t *value) {
+
+    uint64_t result = 0;
+    NSUInteger shift = 0;
+
+    while (*offset < length && shift < 64) {
+        uint8_t const byte = bytes[(*offset)++];
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+        shift += 7;
+    }
+
+    return false;
+}
+
+static void _TBEventTraceMallocStatistics(malloc_statistics_t *statistics) {
+
+    memset(statistics, 0, sizeof(malloc_statistics_t));
+
+    malloc_zone_statistics(NULL, statistics); // All zones
+}
+
+#pragma mark - Recorder
+
+@implementation TBTabBarControllerEventRecorder {
+
+    NSMutableData *_trace;
+    CFTimeInterval _previousTimestamp;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+
+    self = [super init];
+
+    if (self) {
+        [self _commonInit];
+    }
+
+    return self;
+}
+
+- (void)_commonInit {
+
+    _trace = [NSMutableData dataWithBytes:_TBEventTraceMagic length:sizeof(_TBEventTraceMagic)];
+    [_trace appendBytes:&_TBEventTraceVersion length:sizeof(_TBEventTraceVersion)];
+
+    _numberOfEvents = 0;
+    _previousTimestamp = 0.0;
+}
+
+#pragma mark Public Methods
+
+- (void)recordEvent:(TBTabBarControllerEventType)type firstArgument:(NSUInteger)firstArgument secondArgument:(NSUInteger)secondArgument {
+
+    CFTimeInterval const timestamp = CACurrentMediaTime();
+    uint64_t const delta = _numberOfEvents > 0 ? (uint64_t)MAX(0.0, (timestamp - _previousTimestamp) * USEC_PER_SEC) : 0;
+
+    uint8_t buffer[1 + (10 * 3)]; // The type and three varints
+    NSUInteger length = 0;
+
+    buffer[length++] = type;
+    length += _TBEventTraceWriteVarint(buffer + length, delta);
+    length += _TBEventTraceWriteVarint(buffer + length, firstArgument);
+    length += _TBEventTraceWriteVarint(buffer + length, secondArgument);
+
+    [_trace appendBytes:buffer length:length];
+
+    _previousTimestamp = timestamp;
+    _numberOfEvents += 1;
+}
+
+- (BOOL)writeTraceToURL:(NSURL *)url error:(NSError **)error {
+
+    return [_trace writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+- (void)reset {
+
+    [self _commonInit];
+}
+
+#pragma mark Getters
+
+- (NSData *)trace {
+
+    return [_trace copy];
+}
+
+@end
+
+#pragma mark - Replay report
+
+@implementation TBTabBarControllerEventReplayReport
+
+- (instancetype)_initWithNumberOfEvents:(NSUInteger)numberOfEvents
+                       recordedDuration:(NSTimeInterval)recordedDuration
+                               duration:(NSTimeInterval)duration
+                        allocatedBlocks:(NSInteger)allocatedBlocks
+                         allocatedBytes:(NSInteger)allocatedBytes {
+
+    self = [super init];
+
+    if (self) {
+        _numberOfEvents = numberOfEvents;
+        _recordedDuration = recordedDuration;
+        _duration = duration;
+        _eventsPerSecond = duration > 0.0 ? (double)numberOfEvents / duration : 0.0;
+        _allocatedBlocks = allocatedBlocks;
+        _allocatedBytes = allocatedBytes;
+    }
+
+    return self;
+}
+
+- (NSString *)description {
+
+    return [NSString stringWithFormat:@"<%@: %p; events = %lu; recorded = %.3fs; replayed = %.3fs (%.0f events/s); blocks = %ld; bytes = %ld>",
+            NSStringFromClass([self class]),
+            self,
+            (unsigned long)_numberOfEvents,
+            _recordedDuration,
+            _duration,
+            _eventsPerSecond,
+            (long)_allocatedBlocks,
+            (long)_allocatedBytes];
+}
+
+@end
+
+#pragma mark - Replayer
+
+typedef struct _TBTabBarControllerEvent {
+    TBTabBarControllerEventType type;
+    uint64_t delta; // Microseconds since the previous event
+    uint64_t firstArgument;
+    uint64_t secondArgument;
+} _TBTabBarControllerEvent;
+
+@implementation TBTabBarControllerEventReplayer {
+
+    _TBTabBarControllerEvent *_events;
+    NSUInteger _numberOfEvents;
+    NSTimeInterval _recordedDuration;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithTrace:(NSData *)trace error:(NSError **)error {
+
+    self = [super init];
+
+    if (self) {
+        if (![self _decodeTrace:trace]) {
+            if (error != NULL) {
+                *error = [NSError errorWithDomain:TBTabBarControllerEventTraceErrorDomain
+                                             code:1
+                                         userInfo:@{NSLocalizedDescriptionKey: @"The trace is malformed or was recorded by an unsupported version."}];
+            }
+            return nil;
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    free(_events);
+}
+
+#pragma mark Public Methods
+
+- (TBTabBarControllerEventReplayReport *)replayOnTabBarController:(TBTabBarController *)tabBarController {
+
+    NSAssert([NSThread isMainThread], @"Traces must be replayed on the main thread");
+
+    // Placeholders are made beforehand, so the allocations of the replayer itself do not count
+    UIImage *image = [[UIImage alloc] init];
+    UIImage *alternateImage = [[UIImage alloc] init];
+
+    malloc_statistics_t initialStatistics, finalStatistics;
+    _TBEventTraceMallocStatistics(&initialStatistics);
+
+    CFTimeInterval const startTime = CACurrentMediaTime();
+
+    for (NSUInteger index = 0; index < _numberOfEvents; index += 1) {
+        @autoreleasepool {
+            [self _replayEvent:_events[index] onTabBarController:tabBarController image:image alternateImage:alternateImage];
+        }
+    }
+
+    CFTimeInterval const duration = CACurrentMediaTime() - startTime;
+
+    _TBEventTraceMallocStatistics(&finalStatistics);
+
+    return [[TBTabBarControllerEventReplayReport alloc] _initWithNumberOfEvents:_numberOfEvents
+                                                              recordedDuration:_recordedDuration
+                                                                      duration:duration
+                                                               allocatedBlocks:(NSInteger)finalStatistics.blocks_in_use - (NSInteger)initialStatistics.blocks_in_use
+                                                                allocatedBytes:(NSInteger)finalStatistics.size_in_use - (NSInteger)initialStatistics.size_in_use];
+}
+
+#pragma mark Private Methods
+
+#pragma mark Decoding
+
+- (BOOL)_decodeTrace:(NSData *)trace {
+
+    const uint8_t *bytes = trace.bytes;
+    NSUInteger const length = trace.length;
+
+    if (length < _TBEventTraceHeaderLength ||
+        memcmp(bytes, _TBEventTraceMagic, sizeof(_TBEventTraceMagic)) != 0 ||
+        bytes[sizeof(_TBEventTraceMagic)] != _TBEventTraceVersion) {
+        return false;
+    }
+
+    // Every event takes at least four bytes
+    NSUInteger const capacity = (length - _TBEventTraceHeaderLength) / 4;
+    _events = capacity > 0 ? malloc(capacity * sizeof(_TBTabBarControllerEvent)) : NULL;
+
+    NSUInteger offset = _TBEventTraceHeaderLength;
+    uint64_t recordedDuration = 0;
+
+    while (offset < length) {
+        _TBTabBarControllerEvent event;
+        event.type = bytes[offset++];
+        if (event.type < TBTabBarControllerEventTypeSetViewControllers || event.type > TBTabBarControllerEventTypeMoveItem ||
+            !_TBEventTraceReadVarint(bytes, length, &offset, &event.delta) ||
+            !_TBEventTraceReadVarint(bytes, length, &offset, &event.firstArgument) ||
+            !_TBEventTraceReadVarint(bytes, length, &offset, &event.secondArgument) ||
+            _numberOfEvents >= capacity) {
+            return false;
+        }
+        recordedDuration += event.delta;
+        _events[_numberOfEvents++] = event;
+    }
+
+    _recordedDuration = (NSTimeInterval)recordedDuration / USEC_PER_SEC;
+
+    return true;
+}
+
+#pragma mark Replaying
+
+- (void)_replayEvent:(_TBTabBarControllerEvent)event
+  onTabBarController:(TBTabBarController *)tabBarController
+               image:(UIImage *)image
+      alternateImage:(UIImage *)alternateImage {
+
+    NSUInteger const numberOfItems = tabBarController.items.count;
+
+    switch (event.type) {
+        case TBTabBarControllerEventTypeSetViewControllers: {
+            NSMutableArray<UIViewController *> *viewControllers = [NSMutableArray arrayWithCapacity:(NSUInteger)event.firstArgument];
+            for (NSUInteger index = 0; index < event.firstArgument; index += 1) {
+                UIViewController *viewController = [[UIViewController alloc] init];
+                viewController.tb_tabBarItem = [[TBTabBarItem alloc] initWithImage:image buttonClass:[TBTabBarButton class]];
+                [viewControllers addObject:viewController];
+            }
+            tabBarController.viewControllers = viewControllers;
+            break;
+        }
+
+        case TBTabBarControllerEventTypeInsertItem: {
+            TBTabBarItem *item = [[TBTabBarItem alloc] initWithImage:image buttonClass:[TBTabBarButton class]];
+            [tabBarController insertItem:item atIndex:MIN((NSUInteger)event.firstArgument, numberOfItems)];
+            break;
+        }
+
+        case TBTabBarControllerEventTypeRemoveItem:
+            if (event.firstArgument < numberOfItems) {
+                [tabBarController removeItemAtIndex:(NSUInteger)event.firstArgument];
+            }
+            break;
+
+        case TBTabBarControllerEventTypeSelectItem:
+            if (event.firstArgument < tabBarController.viewControllers.count) {
+                tabBarController.selectedIndex = (NSUInteger)event.firstArgument;
+            }
+            break;
+
+        case TBTabBarControllerEventTypeChangeItem:
+            if (event.firstArgument < numberOfItems) {
+                [self _changeProperty:(TBTabBarControllerEventItemProperty)event.secondArgument
+                               ofItem:tabBarController.items[(NSUInteger)event.firstArgument]
+                                image:image
+                       alternateImage:alternateImage];
+            }
+            break;
+
+        case TBTabBarControllerEventTypeTransitionToSize: {
+            CGSize const size = (CGSize){(CGFloat)event.firstArgument, (CGFloat)event.secondArgument};
+            [tabBarController beginTabBarTransition];
+            tabBarController.view.bounds = (CGRect){CGPointZero, size};
+            [tabBarController endTabBarTransition];
+            break;
+        }
+
+        case TBTabBarControllerEventTypeMoveItem:
+            if (event.firstArgument < numberOfItems && event.secondArgument < numberOfItems) {
+                [tabBarController moveItemAtIndex:(NSUInteger)event.firstArgument toIndex:(NSUInteger)event.secondArgument];
+            }
+            break;
+    }
+}
+
+- (void)_changeProperty:(TBTabBarControllerEventItemProperty)property
+                 ofItem:(TBTabBarItem *)item
+                  image:(UIImage *)image
+         alternateImage:(UIImage *)alternateImage {
+
+    switch (property) {
+        case TBTabBarControllerEventItemPropertyImage:
+            item.image = item.image == image ? alternateImage : image;
+            break;
+
+        case TBTabBarControllerEventItemPropertySelectedImage:
+            item.selectedImage = item.selectedImage == image ? alternateImage : image;
+            break;
+
+        case TBTabBarControllerEventItemPropertyNotificationIndicator:
+            item.notificationIndicator = item.notificationIndicator == image ? alternateImage : image;
+            break;
+
+        case TBTabBarControllerEventItemPropertyShowsNotificationIndicator:
+            item.showsNotificationIndicator = !item.showsNotificationIndicator;
+            break;
+
+        case TBTabBarControllerEventItemPropertyBadgeValue:
+            item.badgeValue = [NSString stringWithFormat:@"%ld", (long)(item.badgeValue.integerValue + 1)];
+            break;
+
+        case TBTabBarControllerEventItemPropertyEnabled:
+            item.enabled = !item.enabled;
+            break;
+    }
+}
+
+@end
@@ -0,0 +1,154 @@
+//
+//  TBTabBarFootprint.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarFootprint.h"
+#import "TBTabBarItem.h"
+#import "TBTabBarButton.h"
+
+static NSUInteger const _TBFootprintBytesPerPixel = 4;
+
+@implementation TBTabBarFootprint {
+
+    NSHashTable *_countedImages; // Bitmaps that have already been counted, so shared ones are counted once
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithItem:(__kindof TBTabBarItem *)item
+              viewController:(__kindof UIViewController *)viewController
+                     buttons:(NSArray<__kindof TBTabBarButton *> *)buttons {
+
+    self = [super init];
+
+    if (self) {
+        _item = item;
+        _viewController = viewController;
+        _countedImages = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+        [self _measureViewController:viewController];
+        [self _measureItem:item];
+        for (TBTabBarButton *button in buttons) {
+            _imageBytes += [self _bytesOfLayer:button.layer countsLayers:false];
+        }
+        // Nothing has to be kept once the footprint is measured
+        _countedImages = nil;
+    }
+
+    return self;
+}
+
+#pragma mark Overrides
+
+- (NSString *)description {
+
+    return [NSString stringWithFormat:@"<%@: %p; item = %@; views = %lu; layers = %lu; view hierarchy = %lu bytes; images = %lu bytes>",
+            NSStringFromClass([self class]),
+            self,
+            _item.itemIdentifier,
+            (unsigned long)_numberOfViews,
+            (unsigned long)_numberOfLayers,
+            (unsigned long)_viewHierarchyBytes,
+            (unsigned long)_imageBytes];
+}
+
+#pragma mark Private Methods
+
+#pragma mark Measuring
+
+- (void)_measureViewController:(UIViewController *)viewController {
+
+    // Loading the view just to measure it would defeat the purpose
+    if (viewController == nil || !viewController.isViewLoaded) {
+        return;
+    }
+
+    _viewLoaded = true;
+    _numberOfViews = [self _numberOfViewsInHierarchyOfView:viewController.view];
+    _viewHierarchyBytes = [self _bytesOfLayer:viewController.view.layer countsLayers:true];
+}
+
+- (void)_measureItem:(TBTabBarItem *)item {
+
+    _imageBytes += [self _bytesOfImage:item.image.CGImage];
+    _imageBytes += [self _bytesOfImage:item.selectedImage.CGImage];
+    _imageBytes += [self _bytesOfImage:item.notificationIndicator.CGImage];
+}
+
+- (NSUInteger)_numberOfViewsInHierarchyOfView:(UIView *)view {
+
+    NSUInteger numberOfViews = 1;
+
+    for (UIView *subview in view.subviews) {
+        numberOfViews += [self _numberOfViewsInHierarchyOfView:subview];
+    }
+
+    return numberOfViews;
+}
+
+- (NSUInteger)_bytesOfLayer:(CALayer *)layer countsLayers:(BOOL)countsLayers {
+
+    if (countsLayers) {
+        _numberOfLayers += 1;
+    }
+
+    NSUInteger bytes = 0;
+
+    id contents = layer.contents;
+
+    if (contents != nil) {
+        if (CFGetTypeID((__bridge CFTypeRef)contents) == CGImageGetTypeID()) {
+            bytes += [self _bytesOfImage:(__bridge CGImageRef)contents];
+        } else {
+            // The layer draws its own content into a backing store of its size
+            CGFloat const scale = layer.contentsScale;
+            CGSize const size = layer.bounds.size;
+            bytes += (NSUInteger)(ceil(size.width * scale) * ceil(size.height * scale)) * _TBFootprintBytesPerPixel;
+        }
+    }
+
+    for (CALayer *sublayer in layer.sublayers) {
+        bytes += [self _bytesOfLayer:sublayer countsLayers:countsLayers];
+    }
+
+    return bytes;
+}
+
+- (NSUInteger)_bytesOfImage:(CGImageRef)image {
+
+    if (image == NULL || [_countedImages containsObject:(__bridge id)image]) {
+        return 0;
+    }
+
+    [_countedImages addObject:(__bridge id)image];
+
+    return CGImageGetBytesPerRow(image) * CGImageGetHeight(image);
+}
+
+#pragma mark Getters
+
+- (NSUInteger)totalBytes {
+
+    return _viewHierarchyBytes + _imageBytes;
+}
+
+@end
@@ -0,0 +1,269 @@
+//
+//  TBTabBarHitchMonitor.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarHitchMonitor.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+static NSUInteger const _TBHitchPhasesCount = TBTabBarHitchPhaseBarLayout + 1;
+
+#pragma mark - Hitch
+
+@implementation TBTabBarHitch {
+
+    NSTimeInterval _phaseDurations[_TBHitchPhasesCount];
+}
+
+- (instancetype)_initWithPhase:(TBTabBarHitchPhase)phase
+                     timestamp:(CFTimeInterval)timestamp
+                 frameDuration:(NSTimeInterval)frameDuration
+         expectedFrameDuration:(NSTimeInterval)expectedFrameDuration
+                phaseDurations:(const NSTimeInterval *)phaseDurations {
+
+    self = [super init];
+
+    if (self) {
+        _phase = phase;
+        _timestamp = timestamp;
+        _frameDuration = frameDuration;
+        _expectedFrameDuration = expectedFrameDuration;
+        _hitchDuration = MAX(0.0, frameDuration - expectedFrameDuration);
+        memcpy(_phaseDurations, phaseDurations, sizeof(_phaseDurations));
+    }
+
+    return self;
+}
+
+- (NSTimeInterval)durationOfPhase:(TBTabBarHitchPhase)phase {
+
+    return phase < _TBHitchPhasesCount ? _phaseDurations[phase] : 0.0;
+}
+
+- (NSString *)description {
+
+    return [NSString stringWithFormat:@"<%@: %p; phase = %lu; frame = %.1fms; expected = %.1fms; late by = %.1fms; tab transition = %.1fms; tab bar transition = %.1fms; bar layout = %.1fms>",
+            NSStringFromClass([self class]),
+            self,
+            (unsigned long)_phase,
+            _frameDuration * 1000.0,
+            _expectedFrameDuration * 1000.0,
+            _hitchDuration * 1000.0,
+            _phaseDurations[TBTabBarHitchPhaseTabTransition] * 1000.0,
+            _phaseDurations[TBTabBarHitchPhaseTabBarTransition] * 1000.0,
+            _phaseDurations[TBTabBarHitchPhaseBarLayout] * 1000.0];
+}
+
+@end
+
+#pragma mark - Monitor
+
+@implementation TBTabBarHitchMonitor {
+
+    CADisplayLink *_displayLink;
+    CFTimeInterval _previousFrameTimestamp;
+
+    NSUInteger _phaseDepths[_TBHitchPhasesCount];
+    CFTimeInterval _phaseTimestamps[_TBHitchPhasesCount]; // When the phase began or the current frame started, whichever is later
+    NSTimeInterval _framePhaseDurations[_TBHitchPhasesCount]; // The time every phase has been running during the current frame
+    NSTimeInterval _totalPhaseDurations[_TBHitchPhasesCount];
+
+    TBTabBarHitchPhase _framePhase; // The innermost phase that has been running during the current frame
+    BOOL _hasFramePhase;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+
+    self = [super init];
+
+    if (self) {
+        _tolerance = 0.5;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    [_displayLink invalidate];
+}
+
+#pragma mark Public Methods
+
+- (NSTimeInterval)durationOfPhase:(TBTabBarHitchPhase)phase {
+
+    return phase < _TBHitchPhasesCount ? _totalPhaseDurations[phase] : 0.0;
+}
+
+- (void)beginPhase:(TBTabBarHitchPhase)phase {
+
+    if (phase >= _TBHitchPhasesCount) {
+        return;
+    }
+
+    BOOL const startsMonitoring = (phase != TBTabBarHitchPhaseBarLayout);
+
+    if (!startsMonitoring && _displayLink == nil) {
+        // Layout passes outside of transitions are not watched
+        return;
+    }
+
+    CFTimeInterval const timestamp = CACurrentMediaTime();
+
+    if (_phaseDepths[phase] == 0) {
+        _phaseTimestamps[phase] = timestamp;
+    }
+
+    _phaseDepths[phase] += 1;
+
+    _framePhase = phase;
+    _hasFramePhase = true;
+
+    if (_displayLink == nil) {
+        [self _startMonitoringAtTimestamp:timestamp];
+    }
+}
+
+- (void)endPhase:(TBTabBarHitchPhase)phase {
+
+    if (phase >= _TBHitchPhasesCount || _phaseDepths[phase] == 0) {
+        return;
+    }
+
+    _phaseDepths[phase] -= 1;
+
+    if (_phaseDepths[phase] > 0) {
+        return;
+    }
+
+    NSTimeInterval const duration = CACurrentMediaTime() - _phaseTimestamps[phase];
+
+    _framePhaseDurations[phase] += duration;
+    _totalPhaseDurations[phase] += duration;
+}
+
+- (void)reset {
+
+    _numberOfHitches = 0;
+    _totalHitchDuration = 0.0;
+
+    memset(_totalPhaseDurations, 0, sizeof(_totalPhaseDurations));
+}
+
+#pragma mark Private Methods
+
+#pragma mark Monitoring
+
+- (void)_startMonitoringAtTimestamp:(CFTimeInterval)timestamp {
+
+    // The work that started the phase counts towards the first frame
+    _previousFrameTimestamp = timestamp;
+
+    _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(_displayLinkDidFire:)];
+    [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)_stopMonitoring {
+
+    [_displayLink invalidate];
+    _displayLink = nil;
+
+    memset(_framePhaseDurations, 0, sizeof(_framePhaseDurations));
+
+    _hasFramePhase = false;
+}
+
+- (void)_displayLinkDidFire:(CADisplayLink *)displayLink {
+
+    CFTimeInterval const now = CACurrentMediaTime();
+
+    // The phases still in flight are accounted up to this frame
+
+    for (NSUInteger phase = 0; phase < _TBHitchPhasesCount; phase += 1) {
+        if (_phaseDepths[phase] > 0) {
+            NSTimeInterval const duration = now - _phaseTimestamps[phase];
+            _framePhaseDurations[phase] += duration;
+            _totalPhaseDurations[phase] += duration;
+            _phaseTimestamps[phase] = now;
+        }
+    }
+
+    CFTimeInterval const timestamp = displayLink.timestamp;
+    NSTimeInterval const frameDuration = timestamp - _previousFrameTimestamp;
+    NSTimeInterval const expectedFrameDuration = displayLink.targetTimestamp - timestamp;
+
+    if (_hasFramePhase && expectedFrameDuration > 0.0 && frameDuration > expectedFrameDuration * (1.0 + _tolerance)) {
+        [self _reportHitchWithTimestamp:timestamp frameDuration:frameDuration expectedFrameDuration:expectedFrameDuration];
+    }
+
+    _previousFrameTimestamp = timestamp;
+
+    memset(_framePhaseDurations, 0, sizeof(_framePhaseDurations));
+
+    // The next frame starts in the innermost phase that is still in flight
+
+    _hasFramePhase = false;
+
+    for (NSUInteger phase = 0; phase < _TBHitchPhasesCount; phase += 1) {
+        if (_phaseDepths[phase] > 0) {
+            _framePhase = phase;
+            _hasFramePhase = true;
+        }
+    }
+
+    if (_phaseDepths[TBTabBarHitchPhaseTabTransition] == 0 && _phaseDepths[TBTabBarHitchPhaseTabBarTransition] == 0) {
+        // The frame that finished the last transition has been measured
+        [self _stopMonitoring];
+    }
+}
+
+- (void)_reportHitchWithTimestamp:(CFTimeInterval)timestamp
+                    frameDuration:(NSTimeInterval)frameDuration
+            expectedFrameDuration:(NSTimeInterval)expectedFrameDuration {
+
+    TBTabBarHitch *hitch = [[TBTabBarHitch alloc] _initWithPhase:_framePhase
+                                                       timestamp:timestamp
+                                                   frameDuration:frameDuration
+                                           expectedFrameDuration:expectedFrameDuration
+                                                  phaseDurations:_framePhaseDurations];
+
+    _numberOfHitches += 1;
+    _totalHitchDuration += hitch.hitchDuration;
+
+    id<TBTabBarHitchMonitorDelegate> delegate = self.delegate;
+
+    if ([delegate respondsToSelector:@selector(hitchMonitor:didDetectHitch:)]) {
+        [delegate hitchMonitor:self didDetectHitch:hitch];
+    }
+}
+
+#pragma mark Getters
+
+- (BOOL)isMonitoring {
+
+    return _displayLink != nil;
+}
+
+@end
@@ -25,13 +25,51 @@
 #import "TBTabBarItem.h"
 #import "TBTabBarButton.h"
 #import "_TBUtils.h"
+#import "_TBImageStore.h"
+#import "_TBMainThreadUpdateQueue.h"
 #import "UIApplication+Extensions.h"
 
 static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
 
-@implementation TBTabBarItem
+/// The properties that can be written from any thread
+typedef NS_ENUM(NSUInteger, _TBTabBarItemProperty) {
+    _TBTabBarItemPropertyEnabled,
+    _TBTabBarItemPropertyShowsNotificationIndicator,
+    _TBTabBarItemPropertyTitle,
+    _TBTabBarItemPropertyImage,
+    _TBTabBarItemPropertySelectedImage,
+    _TBTabBarItemPropertyNotificationIndicator,
+    _TBTabBarItemPropertyBadgeValue,
+    _TBTabBarItemPropertiesCount
+};
+
+@interface TBTabBarItem ()
+
+- (void)_applyQueuedValue:(nullable id)value forProperty:(_TBTabBarItemProperty)property sequenceNumber:(uint64_t)sequenceNumber;
+
+@end
+
+static _TBMainThreadUpdateQueue *_TBTabBarItemUpdateQueue(void) {
+
+    static _TBMainThreadUpdateQueue *updateQueue;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        updateQueue = [[_TBMainThreadUpdateQueue alloc] initWithHandler:^(id target, NSUInteger key, id value, uint64_t sequenceNumber) {
+            [(TBTabBarItem *)target _applyQueuedValue:value forProperty:key sequenceNumber:sequenceNumber];
+        }];
+    });
+
+    return updateQueue;
+}
+
+@implementation TBTabBarItem {
+
+    uint64_t _sequenceNumbers[_TBTabBarItemPropertiesCount]; // The sequence numbers of the last writes made on the main thread
+}
 
 @synthesize notificationIndicator = _notificationIndicator;
+@synthesize itemIdentifier = _itemIdentifier;
 
 #pragma mark - Public
 
@@ -54,9 +92,11 @@ static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
     if (self) {
         _buttonClass = buttonClass != nil ? buttonClass : [TBTabBarButton class];
         _title = title;
-        _image = image;
-        _selectedImage = selectedImage;
+        _image = [self _storedImageForImage:image property:_TBTabBarItemPropertyImage];
+        _selectedImage = [self _storedImageForImage:selectedImage property:_TBTabBarItemPropertySelectedImage];
         _enabled = true;
+        // Assigned right away, so reading it never writes to the item
+        _itemIdentifier = [NSUUID UUID].UUIDString;
     }
 
     return self;
@@ -64,6 +104,31 @@ static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
 
 #pragma mark Overrides
 
++ (BOOL)automaticallyNotifiesObserversForKey:(NSString *)key {
+
+    static NSSet<NSString *> *manuallyNotifiedKeys;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        // Setters called off the main thread must not notify observers there, so these are notified by hand
+        manuallyNotifiedKeys = [NSSet setWithObjects:@"enabled",
+                                NSStringFromSelector(@selector(isEnabled)),
+                                NSStringFromSelector(@selector(showsNotificationIndicator)),
+                                NSStringFromSelector(@selector(title)),
+                                NSStringFromSelector(@selector(image)),
+                                NSStringFromSelector(@selector(selectedImage)),
+                                NSStringFromSelector(@selector(notificationIndicator)),
+                                NSStringFromSelector(@selector(badgeValue)),
+                                nil];
+    });
+
+    if ([manuallyNotifiedKeys containsObject:key]) {
+        return false;
+    }
+
+    return [super automaticallyNotifiesObserversForKey:key];
+}
+
 - (NSUInteger)hash {
 
     return TB_UINT_ROTATE(self.image.hash, TB_UINT_BIT / 2) ^ self.buttonClass.hash;
@@ -91,12 +156,16 @@ static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
     TBTabBarItem *copy = [[[self class] allocWithZone:zone] init];
 
     if (copy != nil) {
-        copy.title = [self.title copy];
-        copy.image = [self.image copy];
-        copy.selectedImage = [self.selectedImage copy];
-        copy.notificationIndicator = [self.notificationIndicator copy];
+        // Ivars are copied directly, the copy is not observed yet, so there is nothing to notify
+        copy->_title = [self.title copy];
+        // Images are immutable, so the copy shares them instead of holding on to duplicates
+        copy->_image = self.image;
+        copy->_selectedImage = self.selectedImage;
+        copy->_notificationIndicator = self.notificationIndicator;
+        copy->_badgeValue = [self.badgeValue copy];
         copy->_showsNotificationIndicator = _showsNotificationIndicator;
         copy->_enabled = _enabled;
+        copy->_itemIdentifier = self.itemIdentifier;
         copy->_buttonClass = [self.buttonClass copy];
     }
 
@@ -105,10 +174,117 @@ static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
 
 #pragma mark Private Methods
 
+#pragma mark Updates
+
+- (BOOL)_shouldSetValue:(id)value forProperty:(_TBTabBarItemProperty)property {
+
+    _TBMainThreadUpdateQueue *updateQueue = _TBTabBarItemUpdateQueue();
+
+    if ([NSThread isMainThread] == false) {
+        // Observers touch views, so the write is applied on the main thread, merged with the writes that follow it
+        [updateQueue enqueueValue:value forKey:property target:self];
+        return false;
+    }
+
+    _sequenceNumbers[property] = [updateQueue nextSequenceNumber];
+
+    return true;
+}
+
+- (void)_applyQueuedValue:(id)value forProperty:(_TBTabBarItemProperty)property sequenceNumber:(uint64_t)sequenceNumber {
+
+    if (sequenceNumber < _sequenceNumbers[property]) {
+        // The property was written on the main thread after this value was queued
+        return;
+    }
+
+    switch (property) {
+        case _TBTabBarItemPropertyEnabled:
+            self.enabled = [(NSNumber *)value boolValue];
+            break;
+        case _TBTabBarItemPropertyShowsNotificationIndicator:
+            self.showsNotificationIndicator = [(NSNumber *)value boolValue];
+            break;
+        case _TBTabBarItemPropertyTitle:
+            self.title = value;
+            break;
+        case _TBTabBarItemPropertyImage:
+            self.image = value;
+            break;
+        case _TBTabBarItemPropertySelectedImage:
+            self.selectedImage = value;
+            break;
+        case _TBTabBarItemPropertyNotificationIndicator:
+            self.notificationIndicator = value;
+            break;
+        case _TBTabBarItemPropertyBadgeValue:
+            self.badgeValue = value;
+            break;
+        default:
+            break;
+    }
+}
+
+#pragma mark Images
+
+- (UIImage *)_storedImageForImage:(UIImage *)image property:(_TBTabBarItemProperty)property {
+
+    __weak typeof(self) weakSelf = self;
+
+    return [[_TBImageStore sharedStore] imageForImage:image replacementHandler:^(UIImage *storedImage) {
+        [weakSelf _replaceImage:image withStoredImage:storedImage forProperty:property];
+    }];
+}
+
+- (void)_replaceImage:(UIImage *)image withStoredImage:(UIImage *)storedImage forProperty:(_TBTabBarItemProperty)property {
+
+    NSString *key;
+    UIImage *__strong *imageRef;
+
+    switch (property) {
+        case _TBTabBarItemPropertyImage:
+            key = NSStringFromSelector(@selector(image));
+            imageRef = &_image;
+            break;
+        case _TBTabBarItemPropertySelectedImage:
+            key = NSStringFromSelector(@selector(selectedImage));
+            imageRef = &_selectedImage;
+            break;
+        case _TBTabBarItemPropertyNotificationIndicator:
+            key = NSStringFromSelector(@selector(notificationIndicator));
+            imageRef = &_notificationIndicator;
+            break;
+        default:
+            return;
+    }
+
+    if (*imageRef != image) {
+        // Another image was set since, the stored one is not needed anymore
+        return;
+    }
+
+    // Observers are notified, so the buttons let go of the duplicate as well
+
+    [self willChangeValueForKey:key];
+
+    *imageRef = storedImage;
+
+    [self didChangeValueForKey:key];
+}
+
 #pragma mark Helpers
 
 - (UIImage *)makeNotificationIndicatorImage {
-    return _TBDrawFilledCircleWithSize((CGSize){5.0, 5.0}, [UIScreen mainScreen].nativeScale);
+
+    static UIImage *notificationIndicatorImage;
+    static dispatch_once_t onceToken;
+
+    // The scale of the main screen never changes, so every item shares one dot
+    dispatch_once(&onceToken, ^{
+        notificationIndicatorImage = _TBDrawFilledCircleWithSize((CGSize){5.0, 5.0}, [UIScreen mainScreen].nativeScale);
+    });
+
+    return notificationIndicatorImage;
 }
 
 #pragma mark Getters
@@ -124,25 +300,121 @@ static NSString *const _TBTabBarItemNotificationIndicatorImageName = @"circle";
 
 #pragma mark Setters
 
+- (void)setItemIdentifier:(NSString *)itemIdentifier {
+
+    _itemIdentifier = itemIdentifier != nil ? [itemIdentifier copy] : [NSUUID UUID].UUIDString;
+}
+
+- (void)setTitle:(NSString *)title {
+
+    title = [title copy];
+
+    if ([self _shouldSetValue:title forProperty:_TBTabBarItemPropertyTitle] == false) {
+        return;
+    }
+
+    NSString *key = NSStringFromSelector(@selector(title));
+
+    [self willChangeValueForKey:key];
+
+    _title = title;
+
+    [self didChangeValueForKey:key];
+}
+
+- (void)setImage:(UIImage *)image {
+
+    if ([self _shouldSetValue:image forProperty:_TBTabBarItemPropertyImage] == false) {
+        return;
+    }
+
+    NSString *key = NSStringFromSelector(@selector(image));
+
+    [self willChangeValueForKey:key];
+
+    _image = [self _storedImageForImage:image property:_TBTabBarItemPropertyImage];
+
+    [self didChangeValueForKey:key];
+}
+
+- (void)setSelectedImage:(UIImage *)selectedImage {
+
+    if ([self _shouldSetValue:selectedImage forProperty:_TBTabBarItemPropertySelectedImage] == false) {
+        return;
+    }
+
+    NSString *key = NSStringFromSelector(@selector(selectedImage));
+
+    [self willChangeValueForKey:key];
+
+    _selectedImage = [self _storedImageForImage:selectedImage property:_TBTabBarItemPropertySelectedImage];
+
+    [self didChangeValueForKey:key];
+}
+
+- (void)setBadgeValue:(NSString *)badgeValue {
+
+    badgeValue = [badgeValue copy];
+
+    if ([self _shouldSetValue:badgeValue forProperty:_TBTabBarItemPropertyBadgeValue] == false) {
+        return;
+    }
+
+    NSString *key = NSStringFromSelector(@selector(badgeValue));
+
+    [self willChangeValueForKey:key];
+
+    _badgeValue = badgeValue;
+
+    [self didChangeValueForKey:key];
+}
+
+- (void)setShowsNotificationIndicator:(BOOL)showsNotificationIndicator {
+
+    if ([self _shouldSetValue:@(showsNotificationIndicator) forProperty:_TBTabBarItemPropertyShowsNotificationIndicator] == false) {
+        return;
+    }
+
+    NSString *key = NSStringFromSelector(@selector(showsNotificationIndicator));
+
+    [self willChangeValueForKey:key];
+
+    _showsNotificationIndicator = showsNotificationIndicator;
+
+    [self didChangeValueForKey:key];
+}
+
 - (void)setEnabled:(BOOL)enabled {
 
-    NSString *key = NSStringFromSelector(@selector(isEnabled));
+    if ([self _shouldSetValue:@(enabled) forProperty:_TBTabBarItemPropertyEnabled] == false) {
+        return;
+    }
+
+    // Swift key paths observe the property ("enabled"), the tab bar controller observes its getter ("isEnabled")
+    NSString *key = @"enabled";
+    NSString *getterKey = NSStringFromSelector(@selector(isEnabled));
 
     [self willChangeValueForKey:key];
+    [self willChangeValueForKey:getterKey];
 
     _enabled = enabled;
 
+    [self didChangeValueForKey:getterKey];
     [self didChangeValueForKey:key];
 }
 
 - (void)setNotificationIndicator:(UIImage *)notificationIndicator {
 
+    if ([self _shouldSetValue:notificationIndicator forProperty:_TBTabBarItemPropertyNotificationIndicator] == false) {
+        return;
+    }
+
     NSString *key = NSStringFromSelector(@selector(notificationIndicator));
 
     [self willChangeValueForKey:key];
 
     if (notificationIndicator != nil) {
-        _notificationIndicator = notificationIndicator;
+        _notificationIndicator = [self _storedImageForImage:notificationIndicator property:_TBTabBarItemPropertyNotificationIndicator];
     } else {
         _notificationIndicator = [self makeNotificationIndicatorImage];
     }
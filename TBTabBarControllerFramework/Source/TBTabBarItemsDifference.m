@@ -24,9 +24,154 @@
 
 #import "TBTabBarItemsDifference.h"
 #import "TBTabBarItemChange.h"
+#import "TBTabBarItem.h"
 #import "_TBUtils.h"
 #import "NSArray+Extensions.h"
 
+#import <os/lock.h>
+
+/// The scratch buffer of the pre-iOS 13 diff, reused between calls to avoid allocating on every update of a tab bar
+static NSInteger *_TBItemsDifferenceScratchBuffer;
+static NSUInteger _TBItemsDifferenceScratchBufferCapacity;
+static os_unfair_lock _TBItemsDifferenceScratchBufferLock = OS_UNFAIR_LOCK_INIT;
+
+static BOOL _TBItemsDifferenceReserve(NSInteger **buffer, NSUInteger *capacity, NSUInteger length) {
+
+    if (*capacity >= length) {
+        return true;
+    }
+
+    NSUInteger const newCapacity = MAX(length, *capacity * 2);
+    NSInteger *newBuffer = realloc(*buffer, newCapacity * sizeof(NSInteger));
+
+    if (newBuffer == NULL) {
+        return false;
+    }
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return true;
+}
+
+/**
+ * Computes the shortest edit script between two arrays with the Myers algorithm (O((N + M) * D) time).
+ * The buffer keeps the furthest reaching paths of every step for backtracking, so it takes O((N + M) * D) memory.
+ * Removed indexes refer to the old array, inserted indexes refer to the new one, just like in `NSOrderedCollectionDifference`.
+ */
+static BOOL _TBItemsDifferenceMakeEditScript(NSArray *oldItems,
+                                             NSArray *newItems,
+                                             NSMutableIndexSet *removedIndexes,
+                                             NSMutableIndexSet *insertedIndexes,
+                                             NSInteger **buffer,
+                                             NSUInteger *capacity) {
+
+    NSInteger const oldCount = (NSInteger)oldItems.count;
+    NSInteger const newCount = (NSInteger)newItems.count;
+
+    __unsafe_unretained id *a = (__unsafe_unretained id *)malloc(MAX(oldCount, 1) * sizeof(id));
+    __unsafe_unretained id *b = (__unsafe_unretained id *)malloc(MAX(newCount, 1) * sizeof(id));
+
+    if (a == NULL || b == NULL) {
+        free(a);
+        free(b);
+        return false;
+    }
+
+    [oldItems getObjects:a range:NSMakeRange(0, oldCount)];
+    [newItems getObjects:b range:NSMakeRange(0, newCount)];
+
+    // Common prefix and suffix do not take part in the search
+
+    NSInteger start = 0;
+    NSInteger oldEnd = oldCount;
+    NSInteger newEnd = newCount;
+
+    while (start < oldEnd && start < newEnd && [a[start] isEqual:b[start]]) {
+        start += 1;
+    }
+
+    while (oldEnd > start && newEnd > start && [a[oldEnd - 1] isEqual:b[newEnd - 1]]) {
+        oldEnd -= 1;
+        newEnd -= 1;
+    }
+
+    NSInteger const n = oldEnd - start;
+    NSInteger const m = newEnd - start;
+    NSInteger const max = n + m;
+    NSInteger const width = (2 * max) + 2;
+    NSInteger const offset = max + 1;
+
+    if (n == 0 || m == 0) {
+        [removedIndexes addIndexesInRange:NSMakeRange(start, n)];
+        [insertedIndexes addIndexesInRange:NSMakeRange(start, m)];
+        free(a);
+        free(b);
+        return true;
+    }
+
+    // Forward pass: the buffer starts with the current paths, followed by a snapshot of them taken before every step
+
+    if (!_TBItemsDifferenceReserve(buffer, capacity, width)) {
+        free(a);
+        free(b);
+        return false;
+    }
+
+    (*buffer)[offset + 1] = 0;
+
+    NSInteger distance = -1;
+
+    for (NSInteger d = 0; d <= max && distance < 0; d += 1) {
+        if (!_TBItemsDifferenceReserve(buffer, capacity, (d + 2) * width)) {
+            free(a);
+            free(b);
+            return false;
+        }
+        NSInteger *v = *buffer;
+        memcpy(v + ((d + 1) * width), v, width * sizeof(NSInteger));
+        for (NSInteger k = -d; k <= d; k += 2) {
+            NSInteger x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1])) ? v[offset + k + 1] : v[offset + k - 1] + 1;
+            NSInteger y = x - k;
+            while (x < n && y < m && [a[start + x] isEqual:b[start + y]]) {
+                x += 1;
+                y += 1;
+            }
+            v[offset + k] = x;
+            if (x >= n && y >= m) {
+                distance = d;
+                break;
+            }
+        }
+    }
+
+    // Backtracking
+
+    NSInteger x = n;
+    NSInteger y = m;
+
+    for (NSInteger d = distance; d > 0; d -= 1) {
+        NSInteger const *v = *buffer + ((d + 1) * width);
+        NSInteger const k = x - y;
+        NSInteger const previousK = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1])) ? k + 1 : k - 1;
+        NSInteger const previousX = v[offset + previousK];
+        NSInteger const previousY = previousX - previousK;
+        if (previousK == k + 1) {
+            // A step down, the snake that follows it is skipped
+            [insertedIndexes addIndex:start + previousY];
+        } else {
+            [removedIndexes addIndex:start + previousX];
+        }
+        x = previousX;
+        y = previousY;
+    }
+
+    free(a);
+    free(b);
+
+    return true;
+}
+
 @implementation TBTabBarItemsDifference
 
 #pragma mark Lifecycle
@@ -58,7 +203,7 @@
 + (instancetype)differenceWithItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other {
 
     if (array.count == 0) {
-        return [[TBTabBarItemsDifference alloc] initWithChanges:[self _changesFrom:array insertion:false]];
+        return [[TBTabBarItemsDifference alloc] initWithChanges:[[self _changesFrom:other insertion:false] reversed]];
     } else if (other.count == 0) {
         return [[TBTabBarItemsDifference alloc] initWithChanges:[self _changesFrom:array insertion:true]];
     }
@@ -66,11 +211,19 @@
     if (@available(iOS 13.0, *)) {
         return [[TBTabBarItemsDifference alloc] initWithCollectionDifference:[array differenceFromArray:other]];
     } else {
-        NSArray<TBTabBarItemChange *> *removals = [[self _changesFrom:other insertion:false] reversed];
-        NSArray<TBTabBarItemChange *> *insertions = [self _changesFrom:array insertion:true];
-        NSArray<TBTabBarItemChange *> *changes = [removals arrayByAddingObjectsFromArray:insertions];
-        return [[TBTabBarItemsDifference alloc] initWithChanges:changes];
+        return [[TBTabBarItemsDifference alloc] initWithChanges:[self _changesWithItems:array from:other]];
+    }
+}
+
++ (instancetype)differenceByIdentifyingItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other {
+
+    if (array.count == 0) {
+        return [[TBTabBarItemsDifference alloc] initWithChanges:[[self _changesFrom:other insertion:false] reversed]];
+    } else if (other.count == 0) {
+        return [[TBTabBarItemsDifference alloc] initWithChanges:[self _changesFrom:array insertion:true]];
     }
+
+    return [[TBTabBarItemsDifference alloc] initWithChanges:[self _changesByIdentifyingItems:array from:other]];
 }
 
 #pragma mark Overrides
@@ -99,6 +252,133 @@
 
 #pragma mark Private Methods
 
++ (NSArray<TBTabBarItemChange *> *)_changesWithItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other {
+
+    NSMutableIndexSet *removedIndexes = [NSMutableIndexSet indexSet];
+    NSMutableIndexSet *insertedIndexes = [NSMutableIndexSet indexSet];
+
+    BOOL success;
+
+    if (os_unfair_lock_trylock(&_TBItemsDifferenceScratchBufferLock)) {
+        success = _TBItemsDifferenceMakeEditScript(other, array, removedIndexes, insertedIndexes, &_TBItemsDifferenceScratchBuffer, &_TBItemsDifferenceScratchBufferCapacity);
+        os_unfair_lock_unlock(&_TBItemsDifferenceScratchBufferLock);
+    } else {
+        // Another thread is using the shared buffer
+        NSInteger *buffer = NULL;
+        NSUInteger capacity = 0;
+        success = _TBItemsDifferenceMakeEditScript(other, array, removedIndexes, insertedIndexes, &buffer, &capacity);
+        free(buffer);
+    }
+
+    if (!success) {
+        // Out of memory, everything is replaced
+        NSArray<TBTabBarItemChange *> *removals = [[self _changesFrom:other insertion:false] reversed];
+        return [removals arrayByAddingObjectsFromArray:[self _changesFrom:array insertion:true]];
+    }
+
+    // Removals go from the end so the indexes stay valid while they are applied, insertions go from the start
+
+    NSMutableArray<TBTabBarItemChange *> *changes = [NSMutableArray arrayWithCapacity:removedIndexes.count + insertedIndexes.count];
+
+    [removedIndexes enumerateIndexesWithOptions:NSEnumerationReverse usingBlock:^(NSUInteger index, BOOL * _Nonnull stop) {
+        [changes addObject:[[TBTabBarItemChange alloc] initWithItem:other[index] type:TBTabBarItemChangeRemove index:index]];
+    }];
+
+    [insertedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL * _Nonnull stop) {
+        [changes addObject:[[TBTabBarItemChange alloc] initWithItem:array[index] type:TBTabBarItemChangeInsert index:index]];
+    }];
+
+    return [changes copy];
+}
+
++ (NSArray<TBTabBarItemChange *> *)_changesByIdentifyingItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other {
+
+    NSUInteger const newCount = array.count;
+    NSUInteger const oldCount = other.count;
+
+    NSMutableDictionary<NSString *, NSNumber *> *newIndexes = [NSMutableDictionary dictionaryWithCapacity:newCount];
+
+    for (NSUInteger index = 0; index < newCount; index += 1) {
+        newIndexes[array[index].itemIdentifier] = @(index);
+    }
+
+    if (newIndexes.count != newCount || [NSSet setWithArray:[other valueForKey:NSStringFromSelector(@selector(itemIdentifier))]].count != oldCount) {
+        // Tabs with the same identifier, e.g. an item and its copy, cannot be told apart, so the items are compared as a whole instead
+        return [self _changesWithItems:array from:other];
+    }
+
+    // The old items that stay are the longest run of them whose new indexes increase, everything else is either removed or moved
+
+    NSUInteger *positions = malloc(sizeof(NSUInteger) * oldCount); // Old index -> new index
+    NSUInteger *tails = malloc(sizeof(NSUInteger) * oldCount); // Length - 1 -> old index that ends the run of that length
+    NSUInteger *predecessors = malloc(sizeof(NSUInteger) * oldCount); // Old index -> old index before it in its run
+    BOOL *keptNewIndexes = calloc(newCount, sizeof(BOOL));
+    BOOL *keptOldIndexes = calloc(oldCount, sizeof(BOOL));
+
+    if (positions == NULL || tails == NULL || predecessors == NULL || keptNewIndexes == NULL || keptOldIndexes == NULL) {
+        free(positions);
+        free(tails);
+        free(predecessors);
+        free(keptNewIndexes);
+        free(keptOldIndexes);
+        // Out of memory, everything is replaced
+        NSArray<TBTabBarItemChange *> *removals = [[self _changesFrom:other insertion:false] reversed];
+        return [removals arrayByAddingObjectsFromArray:[self _changesFrom:array insertion:true]];
+    }
+
+    NSUInteger runLength = 0;
+
+    for (NSUInteger index = 0; index < oldCount; index += 1) {
+        NSNumber *newIndex = newIndexes[other[index].itemIdentifier];
+        positions[index] = newIndex != nil ? newIndex.unsignedIntegerValue : NSNotFound;
+        if (newIndex == nil) {
+            continue;
+        }
+        // Finds the shortest run that ends with a greater new index, the current item ends a run one item longer
+        NSUInteger low = 0, high = runLength;
+        while (low < high) {
+            NSUInteger const middle = (low + high) / 2;
+            if (positions[tails[middle]] < positions[index]) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        predecessors[index] = low > 0 ? tails[low - 1] : NSNotFound;
+        tails[low] = index;
+        runLength = MAX(runLength, low + 1);
+    }
+
+    for (NSUInteger index = runLength > 0 ? tails[runLength - 1] : NSNotFound; index != NSNotFound; index = predecessors[index]) {
+        keptOldIndexes[index] = true;
+        keptNewIndexes[positions[index]] = true;
+    }
+
+    // Removals go from the end so the indexes stay valid while they are applied, insertions go from the start
+
+    NSMutableArray<TBTabBarItemChange *> *changes = [NSMutableArray arrayWithCapacity:(oldCount - runLength) + (newCount - runLength)];
+
+    for (NSUInteger index = oldCount; index > 0; index -= 1) {
+        if (!keptOldIndexes[index - 1]) {
+            [changes addObject:[[TBTabBarItemChange alloc] initWithItem:other[index - 1] type:TBTabBarItemChangeRemove index:index - 1]];
+        }
+    }
+
+    for (NSUInteger index = 0; index < newCount; index += 1) {
+        if (!keptNewIndexes[index]) {
+            [changes addObject:[[TBTabBarItemChange alloc] initWithItem:array[index] type:TBTabBarItemChangeInsert index:index]];
+        }
+    }
+
+    free(positions);
+    free(tails);
+    free(predecessors);
+    free(keptNewIndexes);
+    free(keptOldIndexes);
+
+    return [changes copy];
+}
+
 + (NSArray<TBTabBarItemChange *> *)_changesFrom:(NSArray<TBTabBarItem *> *)items insertion:(BOOL)insertion {
 
     NSUInteger const length = items.count;
@@ -0,0 +1,428 @@
+//
+//  TBTabBarLayerButton.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarLayerButton.h"
+#import "TBTabBarButton+Private.h"
+#import "TBTabBarItem.h"
+#import "_TBUtils.h"
+#import "_TBSceneResources.h"
+#import "UIView+Extensions.h"
+
+static NSString *const _TBTabBarLayerButtonNotificationIndicatorAnimationKey = @"_TBTabBarLayerButtonNotificationIndicatorAnimationKey";
+
+static CGFloat const _TBTabBarLayerButtonNotificationIndicatorSpringDampingRatio = 0.5;
+
+static inline BOOL _TBTabBarLayerButtonImageIsTemplate(UIImage *image) {
+
+    if (image.renderingMode == UIImageRenderingModeAlwaysTemplate) {
+        return true;
+    }
+
+    if (@available(iOS 13.0, *)) {
+        // Symbol images are rendered as templates by default, the same way image views do it
+        return image.renderingMode == UIImageRenderingModeAutomatic && image.isSymbolImage;
+    }
+
+    return false;
+}
+
+static inline CGPoint _TBTabBarLayerButtonCenterOfRect(CGRect rect) {
+
+    return (CGPoint){CGRectGetMidX(rect), CGRectGetMidY(rect)};
+}
+
+@implementation TBTabBarLayerButton {
+
+    UIImage *_image;
+    UIImage *_notificationIndicatorImage;
+    UIColor *_notificationIndicatorTintColor;
+
+    // Render cache. Tinted icons are keyed by tint color, so switching between the default and the selected
+    // tint colors does not draw anything once both of them were rendered.
+    UIImage *_tintedIconsSourceImage;
+    CGFloat _tintedIconsScale;
+    NSMutableDictionary<UIColor *, UIImage *> *_tintedIcons;
+
+    UIImage *_tintedNotificationIndicatorSourceImage;
+    UIColor *_tintedNotificationIndicatorTintColor;
+    CGFloat _tintedNotificationIndicatorScale;
+    UIImage *_tintedNotificationIndicator;
+
+    CGPoint _notificationIndicatorFromPosition;
+    float _notificationIndicatorFromOpacity;
+    NSUInteger _notificationIndicatorAnimationIdentifier;
+    BOOL _notificationIndicatorHiding;
+    BOOL _notificationIndicatorPrefersSpring;
+    BOOL _notificationIndicatorAnimating;
+}
+
+@synthesize iconLayer = _iconLayer;
+@synthesize notificationIndicatorLayer = _notificationIndicatorLayer;
+
+#pragma mark - Public
+
+#pragma mark Overrides
+
+- (void)tintColorDidChange {
+
+    [super tintColorDidChange];
+
+    [self tblyrbtn_updateIconLayerContents];
+
+    if (_notificationIndicatorTintColor == nil) {
+        [self tblyrbtn_updateNotificationIndicatorLayerContents];
+    }
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // Tinted images depend on the display scale and on dynamic colors, both of which are part of the trait collection
+    [self tblyrbtn_updateIconLayerContents];
+    [self tblyrbtn_updateNotificationIndicatorLayerContents];
+}
+
+- (CGRect)imageViewFrameForBounds:(CGRect)bounds {
+
+    CGSize const imageSize = _image.size;
+
+    return _TBPixelAccurateRect((CGRect){
+        (CGPoint){(CGRectGetWidth(bounds) - imageSize.width) / 2.0, (CGRectGetHeight(bounds) - imageSize.height) / 2.0},
+        imageSize
+    }, self.tb_displayScale, true);
+}
+
+#pragma mark Private Methods
+
+#pragma mark Helpers
+
+- (void)tblyrbtn_updateIconLayerContents {
+
+    UIImage *image = _image;
+
+    if (image == nil) {
+        _iconLayer.contents = nil;
+        return;
+    }
+
+    CALayer *iconLayer = self.iconLayer;
+
+    if (iconLayer.superlayer == nil) {
+        [self.layer insertSublayer:iconLayer atIndex:0];
+    }
+
+    UIImage *contentsImage = image;
+
+    if (_TBTabBarLayerButtonImageIsTemplate(image)) {
+        CGFloat const displayScale = self.tb_displayScale;
+        if (_tintedIconsSourceImage != image || _tintedIconsScale != displayScale) {
+            [_tintedIcons removeAllObjects];
+            _tintedIconsSourceImage = image;
+            _tintedIconsScale = displayScale;
+        }
+        UIColor *tintColor = [self tblyrbtn_resolvedColor:self.tintColor];
+        contentsImage = _tintedIcons[tintColor];
+        if (contentsImage == nil) {
+            // The other tab bar has a button for the same item, so most icons are already rendered for the scene
+            contentsImage = [[_TBSceneResources resourcesForView:self] tintedImage:image tintColor:tintColor];
+            if (_tintedIcons == nil) {
+                _tintedIcons = [NSMutableDictionary dictionaryWithCapacity:2];
+            }
+            _tintedIcons[tintColor] = contentsImage;
+        }
+    }
+
+    iconLayer.contents = (__bridge id)contentsImage.CGImage;
+    iconLayer.contentsScale = contentsImage.scale;
+}
+
+- (void)tblyrbtn_updateNotificationIndicatorLayerContents {
+
+    if (_notificationIndicatorLayer == nil) {
+        return;
+    }
+
+    UIImage *image = _notificationIndicatorImage ?: self.tabBarItem.notificationIndicator;
+
+    if (image == nil) {
+        _notificationIndicatorLayer.contents = nil;
+        return;
+    }
+
+    UIImage *contentsImage = image;
+
+    if (_TBTabBarLayerButtonImageIsTemplate(image)) {
+        CGFloat const displayScale = self.tb_displayScale;
+        UIColor *tintColor = [self tblyrbtn_resolvedColor:_notificationIndicatorTintColor ?: self.tintColor];
+        if (_tintedNotificationIndicatorSourceImage != image || _tintedNotificationIndicatorScale != displayScale || [_tintedNotificationIndicatorTintColor isEqual:tintColor] == false) {
+            _tintedNotificationIndicator = [[_TBSceneResources resourcesForView:self] tintedImage:image tintColor:tintColor];
+            _tintedNotificationIndicatorSourceImage = image;
+            _tintedNotificationIndicatorScale = displayScale;
+            _tintedNotificationIndicatorTintColor = tintColor;
+        }
+        contentsImage = _tintedNotificationIndicator;
+    }
+
+    _notificationIndicatorLayer.contents = (__bridge id)contentsImage.CGImage;
+    _notificationIndicatorLayer.contentsScale = contentsImage.scale;
+}
+
+- (UIColor *)tblyrbtn_resolvedColor:(UIColor *)color {
+
+    if (@available(iOS 13.0, *)) {
+        return [color resolvedColorWithTraitCollection:self.traitCollection];
+    }
+
+    return color;
+}
+
+- (CALayer *)tblyrbtn_makeContentLayer {
+
+    CALayer *layer = [CALayer layer];
+    // Content changes must not be animated implicitly; the button animates them explicitly when needed
+    layer.actions = @{
+        @"bounds": [NSNull null],
+        @"position": [NSNull null],
+        @"contents": [NSNull null],
+        @"opacity": [NSNull null],
+        @"sublayers": [NSNull null],
+        @"onOrderIn": [NSNull null],
+        @"onOrderOut": [NSNull null]
+    };
+
+    return layer;
+}
+
+#pragma mark Getters
+
+- (CALayer *)iconLayer {
+
+    if (_iconLayer == nil) {
+        _iconLayer = [self tblyrbtn_makeContentLayer];
+    }
+
+    return _iconLayer;
+}
+
+- (CALayer *)notificationIndicatorLayer {
+
+    if (_notificationIndicatorLayer == nil) {
+        _notificationIndicatorLayer = [self tblyrbtn_makeContentLayer];
+        _notificationIndicatorLayer.opacity = 0.0;
+    }
+
+    return _notificationIndicatorLayer;
+}
+
+#pragma mark Setters
+
+- (void)setNotificationIndicatorSize:(CGSize)notificationIndicatorSize {
+
+    [super setNotificationIndicatorSize:notificationIndicatorSize];
+
+    if (_notificationIndicatorLayer.superlayer != nil) {
+        [self setNeedsLayout];
+    }
+}
+
+- (void)setNotificationIndicatorView:(__kindof UIView *)notificationIndicatorView {
+
+    // The notification indicator is displayed by the `notificationIndicatorLayer`
+}
+
+@end
+
+#pragma mark - Private
+
+@implementation TBTabBarLayerButton (Private)
+
+- (void)_displayImage:(UIImage *)image {
+
+    UIImage *prevImage = _image;
+
+    _image = image;
+
+    [self tblyrbtn_updateIconLayerContents];
+
+    // The frame of the icon depends on the image size only, so there is no need to lay out the button on every state change
+    if ((prevImage == nil) != (image == nil) || CGSizeEqualToSize(prevImage.size, image.size) == false) {
+        [self setNeedsLayout];
+    }
+}
+
+- (void)_layoutContentForBounds:(CGRect)bounds {
+
+    // Badge
+    [super _layoutContentForBounds:bounds];
+
+    // Tab icon
+
+    if (_iconLayer.superlayer != nil && _image != nil) {
+        _iconLayer.frame = [self imageViewFrameForBounds:bounds];
+    }
+
+    // Notification indicator
+
+    if (_notificationIndicatorLayer.superlayer != nil) {
+        CGRect const frame = [self notificationIndicatorViewFrameForBounds:bounds];
+        _notificationIndicatorLayer.bounds = (CGRect){CGPointZero, frame.size};
+        _notificationIndicatorLayer.position = _TBTabBarLayerButtonCenterOfRect(frame);
+    }
+}
+
+- (void)_setNotificationIndicatorImage:(UIImage *)image {
+
+    _notificationIndicatorImage = image;
+
+    [self tblyrbtn_updateNotificationIndicatorLayerContents];
+}
+
+- (void)_setNotificationIndicatorTintColor:(UIColor *)tintColor {
+
+    _notificationIndicatorTintColor = tintColor;
+
+    [self tblyrbtn_updateNotificationIndicatorLayerContents];
+}
+
+- (BOOL)_prepareNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    BOOL const isNotificationIndicatorVisible = !hidden;
+
+    CALayer *notificationIndicatorLayer = self.notificationIndicatorLayer;
+    CALayer *currentLayer = notificationIndicatorLayer.presentationLayer ?: notificationIndicatorLayer;
+
+    _notificationIndicatorFromPosition = currentLayer.position;
+    _notificationIndicatorFromOpacity = currentLayer.opacity;
+
+    if (isNotificationIndicatorVisible && notificationIndicatorLayer.superlayer == nil) {
+        // The indicator appears from its hidden position, so compute it before changing the visibility
+        self.notificationIndicatorVisible = false;
+        _notificationIndicatorFromPosition = _TBTabBarLayerButtonCenterOfRect([self notificationIndicatorViewFrameForBounds:self.bounds]);
+        _notificationIndicatorFromOpacity = 0.0;
+        [self.layer addSublayer:notificationIndicatorLayer];
+    }
+
+    self.notificationIndicatorVisible = isNotificationIndicatorVisible;
+
+    if (isNotificationIndicatorVisible) {
+        [self tblyrbtn_updateNotificationIndicatorLayerContents];
+    }
+
+    // Presentations that interrupt a dismissal are not springy, the same way as in the view-based button
+    _notificationIndicatorPrefersSpring = isNotificationIndicatorVisible && _notificationIndicatorHiding == false;
+
+    return _notificationIndicatorPrefersSpring;
+}
+
+- (void)_animateNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    // Standalone layers are not animated by UIView animation blocks, so the animation is added explicitly
+    // with the duration of the enclosing block. Since the block may be committed in the same transaction
+    // as many other buttons, this still results in a single commit per frame.
+
+    BOOL const isNotificationIndicatorVisible = !hidden;
+
+    CALayer *notificationIndicatorLayer = self.notificationIndicatorLayer;
+
+    CGRect const frame = [self notificationIndicatorViewFrameForBounds:self.bounds];
+    float const toOpacity = isNotificationIndicatorVisible ? 1.0 : 0.0;
+
+    [notificationIndicatorLayer removeAnimationForKey:_TBTabBarLayerButtonNotificationIndicatorAnimationKey];
+
+    notificationIndicatorLayer.bounds = (CGRect){CGPointZero, frame.size};
+    notificationIndicatorLayer.position = _TBTabBarLayerButtonCenterOfRect(frame);
+    notificationIndicatorLayer.opacity = toOpacity;
+
+    NSUInteger const animationIdentifier = ++_notificationIndicatorAnimationIdentifier;
+
+    NSTimeInterval const duration = [UIView inheritedAnimationDuration];
+
+    _notificationIndicatorHiding = false;
+    _notificationIndicatorAnimating = false;
+
+    if ([UIView areAnimationsEnabled] == false || duration <= 0.0) {
+        return;
+    }
+
+    CABasicAnimation *positionAnimation;
+
+    if (_notificationIndicatorPrefersSpring) {
+        // Matches the spring parameters of the view-based button
+        CASpringAnimation *springAnimation = [CASpringAnimation animationWithKeyPath:@"position"];
+        springAnimation.mass = 1.0;
+        springAnimation.stiffness = pow(2.0 * M_PI / duration, 2.0);
+        springAnimation.damping = 4.0 * M_PI * _TBTabBarLayerButtonNotificationIndicatorSpringDampingRatio / duration;
+        positionAnimation = springAnimation;
+    } else {
+        positionAnimation = [CABasicAnimation animationWithKeyPath:@"position"];
+        positionAnimation.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionEaseInEaseOut];
+    }
+
+    positionAnimation.fromValue = [NSValue valueWithCGPoint:_notificationIndicatorFromPosition];
+    positionAnimation.toValue = [NSValue valueWithCGPoint:notificationIndicatorLayer.position];
+
+    CABasicAnimation *opacityAnimation = [CABasicAnimation animationWithKeyPath:@"opacity"];
+    opacityAnimation.fromValue = @(_notificationIndicatorFromOpacity);
+    opacityAnimation.toValue = @(toOpacity);
+    opacityAnimation.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionEaseInEaseOut];
+
+    CAAnimationGroup *animationGroup = [CAAnimationGroup animation];
+    animationGroup.animations = @[positionAnimation, opacityAnimation];
+    animationGroup.duration = duration;
+
+    _notificationIndicatorHiding = hidden;
+    _notificationIndicatorAnimating = true;
+
+    __weak typeof(self) weakSelf = self;
+
+    [CATransaction begin];
+    [CATransaction setCompletionBlock:^{
+        __strong typeof(weakSelf) strongSelf = weakSelf;
+        if (strongSelf == nil || strongSelf->_notificationIndicatorAnimationIdentifier != animationIdentifier) {
+            return;
+        }
+        strongSelf->_notificationIndicatorHiding = false;
+        strongSelf->_notificationIndicatorAnimating = false;
+        if (strongSelf.isNotificationIndicatorVisible == false) {
+            [notificationIndicatorLayer removeFromSuperlayer];
+        }
+    }];
+    [notificationIndicatorLayer addAnimation:animationGroup forKey:_TBTabBarLayerButtonNotificationIndicatorAnimationKey];
+    [CATransaction commit];
+}
+
+- (void)_finishNotificationIndicatorTransitionToHidden:(BOOL)hidden {
+
+    // An explicit animation cleans up on its own, since the enclosing UIView block may complete right away
+    if (_notificationIndicatorAnimating) {
+        return;
+    }
+
+    if (hidden && self.isNotificationIndicatorVisible == false) {
+        [_notificationIndicatorLayer removeFromSuperlayer];
+    }
+}
+
+@end
@@ -0,0 +1,207 @@
+//
+//  TBTabBarSelectionHistory.m
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import "TBTabBarSelectionHistory.h"
+#import "TBTabBarItem.h"
+
+static NSUInteger const _TBTabBarSelectionHistoryDefaultCapacity = 32;
+static double const _TBTabBarSelectionHistoryDefaultUsageDecay = 0.9;
+
+/// Usage grows geometrically instead of decaying, so the values are scaled down before they overflow
+static double const _TBTabBarSelectionHistoryMaximumIncrement = 1.0e100;
+
+@implementation TBTabBarSelectionHistory {
+
+    NSMutableArray<TBTabBarItem *> *_buffer; // The ring buffer
+    NSUInteger _head; // The index of the current item in the ring buffer
+
+    NSMapTable<TBTabBarItem *, NSNumber *> *_usage; // Item -> usage
+    NSMutableArray<TBTabBarItem *> *_ranking; // Ordered by usage, descending
+    double _increment; // The usage of a selection made now
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity usageDecay:(double)usageDecay {
+
+    NSParameterAssert(capacity > 0);
+    NSParameterAssert(usageDecay > 0.0 && usageDecay <= 1.0);
+
+    self = [super init];
+
+    if (self) {
+        _capacity = MAX(capacity, 1);
+        _usageDecay = MIN(MAX(usageDecay, DBL_MIN), 1.0);
+        _buffer = [NSMutableArray arrayWithCapacity:_capacity];
+        _usage = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                       valueOptions:NSPointerFunctionsStrongMemory];
+        _ranking = [NSMutableArray array];
+        _increment = 1.0;
+    }
+
+    return self;
+}
+
+- (instancetype)init {
+
+    return [self initWithCapacity:_TBTabBarSelectionHistoryDefaultCapacity usageDecay:_TBTabBarSelectionHistoryDefaultUsageDecay];
+}
+
+#pragma mark Public Methods
+
+- (void)pushItem:(TBTabBarItem *)item {
+
+    [self _recordUsageOfItem:item];
+
+    if (_count > 0 && _buffer[_head] == item) {
+        return;
+    }
+
+    NSUInteger const head = _count > 0 ? (_head + 1) % _capacity : 0;
+
+    if (head < _buffer.count) {
+        // Overwrites either the oldest selection or one that was popped
+        [_buffer replaceObjectAtIndex:head withObject:item];
+    } else {
+        [_buffer addObject:item];
+    }
+
+    _head = head;
+    _count = MIN(_count + 1, _capacity);
+}
+
+- (TBTabBarItem *)popItem {
+
+    if (_count < 2) {
+        return nil;
+    }
+
+    _head = (_head + _capacity - 1) % _capacity;
+    _count -= 1;
+
+    return _buffer[_head];
+}
+
+- (void)removeItem:(TBTabBarItem *)item {
+
+    if ([_usage objectForKey:item] != nil) {
+        [_usage removeObjectForKey:item];
+        [_ranking removeObjectIdenticalTo:item];
+    }
+
+    // Rebuilds the ring buffer from the oldest selection to the newest one without the item
+
+    NSMutableArray<TBTabBarItem *> *selections = [NSMutableArray arrayWithCapacity:_count];
+
+    for (NSUInteger offset = _count; offset > 0; offset -= 1) {
+        TBTabBarItem *selection = _buffer[(_head + _capacity - (offset - 1)) % _capacity];
+        if (selection != item && selection != selections.lastObject) {
+            [selections addObject:selection];
+        }
+    }
+
+    if (selections.count == _count) {
+        return;
+    }
+
+    _buffer = selections;
+    _count = selections.count;
+    _head = _count > 0 ? _count - 1 : 0;
+}
+
+- (double)usageOfItem:(TBTabBarItem *)item {
+
+    return [_usage objectForKey:item].doubleValue / _increment;
+}
+
+- (void)removeAllItems {
+
+    [_buffer removeAllObjects];
+    [_usage removeAllObjects];
+    [_ranking removeAllObjects];
+
+    _head = 0;
+    _count = 0;
+    _increment = 1.0;
+}
+
+#pragma mark Private Methods
+
+- (void)_recordUsageOfItem:(TBTabBarItem *)item {
+
+    NSNumber *usage = [_usage objectForKey:item];
+    double const newUsage = usage.doubleValue + _increment;
+
+    [_usage setObject:@(newUsage) forKey:item];
+
+    // The item can only move up, so it bubbles from its current position
+
+    NSUInteger index = usage != nil ? [_ranking indexOfObjectIdenticalTo:item] : _ranking.count;
+
+    if (usage != nil) {
+        [_ranking removeObjectAtIndex:index];
+    }
+
+    while (index > 0 && [_usage objectForKey:_ranking[index - 1]].doubleValue < newUsage) {
+        index -= 1;
+    }
+
+    [_ranking insertObject:item atIndex:index];
+
+    // Instead of multiplying every usage by the decay, the next selections are worth more
+
+    _increment /= _usageDecay;
+
+    if (_increment > _TBTabBarSelectionHistoryMaximumIncrement) {
+        [self _rescaleUsage];
+    }
+}
+
+- (void)_rescaleUsage {
+
+    for (TBTabBarItem *item in _ranking) {
+        [_usage setObject:@([_usage objectForKey:item].doubleValue / _increment) forKey:item];
+    }
+
+    _increment = 1.0;
+}
+
+#pragma mark Getters
+
+- (TBTabBarItem *)currentItem {
+
+    return _count > 0 ? _buffer[_head] : nil;
+}
+
+- (TBTabBarItem *)previousItem {
+
+    return _count > 1 ? _buffer[(_head + _capacity - 1) % _capacity] : nil;
+}
+
+- (NSArray<TBTabBarItem *> *)mostUsedItems {
+
+    return [_ranking copy];
+}
+
+@end
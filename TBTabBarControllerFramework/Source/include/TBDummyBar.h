@@ -39,6 +39,14 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (strong, nonatomic, nullable) __kindof UIView *subview;
 
+/**
+ * @abstract Invalidates the size of the subview, so it is asked for its fitting size in the next layout pass.
+ * @discussion The bar caches the result of `sizeThatFits:` of the subview for the size it proposes. Call this method
+ * when the content of the subview changes in a way that changes its fitting size. Replacing the subview
+ * and trait changes invalidate the size on their own.
+ */
+- (void)invalidateSubviewSize;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -124,6 +124,23 @@ typedef NS_ENUM(NSUInteger, TBTabBarControllerTabBarPlacement);
  */
 - (void)_setNotificationIndicatorHidden:(BOOL)hidden forButtonAtIndex:(NSUInteger)index;
 
+/**
+ * @abstract Sets the badge value for a button at a specific index in the tab bar.
+ * @param badgeValue The badge value to set for the button.
+ * @param index The index of the button to set the badge value for.
+ */
+- (void)_setBadgeValue:(nullable NSString *)badgeValue forButtonAtIndex:(NSUInteger)index;
+
+/**
+ * @abstract Updates the badges of all buttons from their tab items in a single pass.
+ */
+- (void)_updateBadgeValues;
+
+/**
+ * @abstract Marks the badges as outdated. They are updated the next time the tab bar becomes visible or lays out its subviews.
+ */
+- (void)_setNeedsUpdateBadgeValues;
+
 /**
  * @abstract Sets additional content insets for the tab bar.
  * @param additionalContentInsets The UIEdgeInsets to set as additional content insets.
@@ -25,7 +25,7 @@
 #import <UIKit/UIKit.h>
 #import "TBSimpleBar.h"
 
-@class TBTabBar, TBTabBarItem, TBTabBarButton, TBTabBarItemsDifference;
+@class TBTabBar, TBTabBarItem, TBTabBarButton, TBTabBarItemsDifference, TBTabBarAppearance;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -68,6 +68,20 @@ shouldSelectItem:(__kindof TBTabBarItem *)item
  didSelectItem:(__kindof TBTabBarItem *)item
        atIndex:(NSUInteger)index;
 
+/**
+ * @abstract Notifies the delegate that the user has dragged a tab to a new place.
+ * @discussion By the time this method is called, the tab bar has already moved the button and updated its visible items,
+ * so the delegate only has to move the item in its own list (`TBTabBarController` calls `moveItemAtIndex:toIndex:`).
+ * @param tabBar The tab bar that triggered the event.
+ * @param item The tab item that was moved.
+ * @param sourceIndex The previous index of the tab item among the visible items.
+ * @param destinationIndex The new index of the tab item among the visible items.
+ */
+- (void)tabBar:(TBTabBar *)tabBar
+   didMoveItem:(__kindof TBTabBarItem *)item
+     fromIndex:(NSUInteger)sourceIndex
+       toIndex:(NSUInteger)destinationIndex;
+
 @end
 
 #pragma mark - Tab bar
@@ -89,6 +103,7 @@ typedef NS_ENUM(NSInteger, TBTabBarLayoutOrientation) {
     struct {
         BOOL shouldSelectItemAtIndex:1;
         BOOL didSelectItemAtIndex:1;
+        BOOL didMoveItem:1;
     } _delegateFlags;
 
     NSMutableArray <__kindof TBTabBarItem *> *_visibleItems;
@@ -112,11 +127,13 @@ typedef NS_ENUM(NSInteger, TBTabBarLayoutOrientation) {
 
 /**
  * @abstract The currently visible tab items in the tab bar.
+ * @discussion The array is an immutable snapshot that is reused until the visible items change, so reading this property does not copy anything.
  */
 @property (strong, nonatomic, readonly) NSArray <__kindof TBTabBarItem *> *visibleItems;
 
 /**
  * @abstract The currently hidden tab items in the tab bar.
+ * @discussion The array is an immutable snapshot that is reused until the hidden items change.
  */
 @property (strong, nonatomic, readonly) NSArray <__kindof TBTabBarItem *> *hiddenItems;
 
@@ -161,6 +178,29 @@ typedef NS_ENUM(NSInteger, TBTabBarLayoutOrientation) {
  */
 @property (assign, nonatomic) CGFloat spaceBetweenTabs UI_APPEARANCE_SELECTOR;
 
+/**
+ * @abstract Indicates whether inserted and removed tabs are animated while the tab bar is visible. The default value is `YES`.
+ * @discussion Inserted tabs fade in, removed tabs fade out and the remaining tabs slide to their new places, all in one animation.
+ */
+@property (assign, nonatomic) BOOL animatesItemChanges;
+
+/**
+ * @abstract Indicates whether the user can rearrange the visible tabs by long-pressing and dragging them. The default value is `NO`.
+ * @discussion The neighbouring tabs make room for the dragged one as it passes over them. When the tab is dropped, the delegate
+ * is notified through `tabBar:didMoveItem:fromIndex:toIndex:`.
+ */
+@property (assign, nonatomic) BOOL allowsItemReordering;
+
+/**
+ * @abstract The gesture recognizer that drags tabs around when `allowsItemReordering` is enabled.
+ */
+@property (strong, nonatomic, readonly) UILongPressGestureRecognizer *reorderingGestureRecognizer;
+
+/**
+ * @abstract A snapshot of the current visual attributes of the tab bar.
+ */
+@property (strong, nonatomic, readonly) TBTabBarAppearance *currentAppearance;
+
 /**
  * @abstract Initializes a TBTabBar instance with the specified layout orientation.
  * @param layoutOrientation The desired layout orientation for the tab bar. Use `TBTabBarLayoutOrientationHorizontal` 
@@ -196,6 +236,14 @@ typedef NS_ENUM(NSInteger, TBTabBarLayoutOrientation) {
  */
 - (nullable TBTabBarButton *)buttonAtTabIndex:(NSUInteger)tabIndex NS_SWIFT_NAME(button(at:));
 
+/**
+ * @abstract Applies all attributes of the given appearance at once.
+ * @discussion Unlike setting the tint colors one by one, this method visits every button only once
+ * and invalidates the layout only when the space between tabs or the size of the notification indicators changes.
+ * @param appearance The appearance to apply.
+ */
+- (void)applyAppearance:(TBTabBarAppearance *)appearance NS_SWIFT_NAME(apply(_:));
+
 @end
 
 #pragma mark - Subclassing
@@ -217,12 +265,14 @@ typedef NS_ENUM(NSInteger, TBTabBarLayoutOrientation) {
 
 /**
  * @abstract Applies the difference to the visible tab items.
+ * @note This method also drops the snapshot returned by `visibleItems`, so overrides should call the superclass implementation.
  * @param difference The difference between the new and old tab items.
  */
 - (void)applyVisibleItemsDifference:(TBTabBarItemsDifference *)difference;
 
 /**
  * @abstract Applies the difference to the hidden tab items.
+ * @note This method also drops the snapshot returned by `hiddenItems`, so overrides should call the superclass implementation.
  * @param difference The difference between the new and old tab items.
  */
 - (void)applyHiddenItemsDifference:(TBTabBarItemsDifference *)difference;
@@ -0,0 +1,110 @@
+//
+//  TBTabBarAppearance.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Appearance
+
+/**
+ * @abstract An immutable set of visual attributes of a tab bar.
+ * @discussion Use `TBTabBarAppearance` to restyle a tab bar in one go, for example when switching themes.
+ * Unlike the individual tint color setters of `TBTabBar`, applying an appearance walks the tab bar buttons only once
+ * and invalidates the layout only when the geometry actually changes.
+ *
+ * A `nil` color means that the tab bar uses its default value for that attribute.
+ *
+ * To create a custom appearance, make a `TBMutableTabBarAppearance`, configure it and pass it (or its copy) to
+ * `-[TBTabBar applyAppearance:]` or `-[TBTabBarController applyTabBarAppearance:]`.
+ */
+@interface TBTabBarAppearance : NSObject <NSCopying, NSMutableCopying>
+
+/**
+ * @abstract The tint color of unselected tab items.
+ */
+@property (strong, nonatomic, readonly, nullable) UIColor *defaultTintColor;
+
+/**
+ * @abstract The tint color of the selected tab item.
+ */
+@property (strong, nonatomic, readonly, nullable) UIColor *selectedTintColor;
+
+/**
+ * @abstract The tint color of the notification indicators.
+ */
+@property (strong, nonatomic, readonly, nullable) UIColor *notificationIndicatorTintColor;
+
+/**
+ * @abstract The color of the separator.
+ */
+@property (strong, nonatomic, readonly, nullable) UIColor *separatorColor;
+
+/**
+ * @abstract The space between tab items. The default value is 4pt.
+ */
+@property (assign, nonatomic, readonly) CGFloat spaceBetweenTabs;
+
+/**
+ * @abstract The size of the notification indicators. The default value is 5pt.
+ */
+@property (assign, nonatomic, readonly) CGSize notificationIndicatorSize;
+
+/**
+ * @abstract Returns an appearance with the default values.
+ */
++ (instancetype)defaultAppearance;
+
+/**
+ * @abstract Returns a Boolean value that indicates whether the given appearance is equal to the receiver.
+ * @param appearance The appearance to compare with.
+ * @return `YES` if all attributes are equal, otherwise `NO`.
+ */
+- (BOOL)isEqualToAppearance:(TBTabBarAppearance *)appearance NS_SWIFT_NAME(isEqual(to:));
+
+@end
+
+#pragma mark - Mutable appearance
+
+/**
+ * @abstract A mutable version of `TBTabBarAppearance`.
+ * @discussion Tab bars always take an immutable copy of the applied appearance, so it is safe to modify the object after applying it.
+ */
+@interface TBMutableTabBarAppearance : TBTabBarAppearance
+
+@property (strong, nonatomic, readwrite, nullable) UIColor *defaultTintColor;
+
+@property (strong, nonatomic, readwrite, nullable) UIColor *selectedTintColor;
+
+@property (strong, nonatomic, readwrite, nullable) UIColor *notificationIndicatorTintColor;
+
+@property (strong, nonatomic, readwrite, nullable) UIColor *separatorColor;
+
+@property (assign, nonatomic, readwrite) CGFloat spaceBetweenTabs;
+
+@property (assign, nonatomic, readwrite) CGSize notificationIndicatorSize;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,104 @@
+//
+//  TBTabBarButton+Private.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+#import "TBTabBarButton.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A private category that exposes the rendering primitives of `TBTabBarButton`.
+ * @discussion `TBTabBarButton` displays its content with views, while its subclasses (such as `TBTabBarLayerButton`)
+ * can override these primitives to display the same content by other means. The tab bar talks to its buttons
+ * through these methods only, so it never has to create views a button does not use.
+ */
+@interface TBTabBarButton (Private)
+
+/**
+ * @abstract Associates the button with another item that represents the same tab and updates the contents of the button to match it.
+ * @discussion Only what differs is updated, so replacing an item with an equivalent one costs nothing.
+ * @param tabBarItem The item.
+ */
+- (void)_setTabBarItem:(TBTabBarItem *)tabBarItem;
+
+/**
+ * @abstract Returns the image that corresponds to the current control state.
+ */
+- (nullable UIImage *)_imageForCurrentState;
+
+/**
+ * @abstract Displays the given image as a tab icon.
+ * @param image The image to display.
+ */
+- (void)_displayImage:(nullable UIImage *)image;
+
+/**
+ * @abstract Lays out the tab icon and the notification indicator within the given bounds.
+ * @discussion This method is called from `layoutSubviews` only when the button needs layout.
+ * @param bounds The bounds of the button.
+ */
+- (void)_layoutContentForBounds:(CGRect)bounds;
+
+/**
+ * @abstract Sets the image of the notification indicator.
+ * @param image The notification indicator image.
+ */
+- (void)_setNotificationIndicatorImage:(nullable UIImage *)image;
+
+/**
+ * @abstract Sets the tint color of the notification indicator.
+ * @param tintColor The notification indicator tint color.
+ */
+- (void)_setNotificationIndicatorTintColor:(nullable UIColor *)tintColor;
+
+/**
+ * @abstract Sets the badge value. Does nothing when the value has not changed, so the rendered badge is reused.
+ * @param badgeValue The badge value.
+ */
+- (void)_setBadgeValue:(nullable NSString *)badgeValue;
+
+/**
+ * @abstract Updates the visibility of the notification indicator and puts it into the initial state of the transition.
+ * @discussion The notification indicator animator calls these three methods in order when it flushes scheduled transitions.
+ * None of them forces a layout pass.
+ * @param hidden Indicates whether the notification indicator is being hidden.
+ * @return `YES` if the presentation should be animated with a spring, `NO` otherwise.
+ */
+- (BOOL)_prepareNotificationIndicatorTransitionToHidden:(BOOL)hidden;
+
+/**
+ * @abstract Puts the notification indicator into the final state of the transition. Called within an animation block.
+ * @param hidden Indicates whether the notification indicator is being hidden.
+ */
+- (void)_animateNotificationIndicatorTransitionToHidden:(BOOL)hidden;
+
+/**
+ * @abstract Cleans up after the transition, for example, removes the hidden notification indicator from the button.
+ * @param hidden Indicates whether the notification indicator was being hidden.
+ */
+- (void)_finishNotificationIndicatorTransitionToHidden:(BOOL)hidden;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -85,6 +85,27 @@ typedef NS_ENUM(NSInteger, TBTabBarButtonLayoutOrientation) {
  */
 @property (assign, nonatomic, getter = isNotificationIndicatorVisible) BOOL notificationIndicatorVisible NS_SWIFT_NAME(isNotificationIndicatorVisible);
 
+/**
+ * @abstract The text displayed in the badge. The badge is hidden when the value is nil or empty.
+ * @discussion The value mirrors the `badgeValue` property of the tab bar item.
+ */
+@property (copy, nonatomic, readonly, nullable) NSString *badgeValue;
+
+/**
+ * @abstract The font of the badge text. The default value is a semibold system font of 11pt with monospaced digits.
+ */
+@property (strong, nonatomic, null_resettable) UIFont *badgeFont UI_APPEARANCE_SELECTOR;
+
+/**
+ * @abstract The color of the badge text. The default value is white.
+ */
+@property (strong, nonatomic, null_resettable) UIColor *badgeTextColor UI_APPEARANCE_SELECTOR;
+
+/**
+ * @abstract The background color of the badge. The default value is the system red color.
+ */
+@property (strong, nonatomic, null_resettable) UIColor *badgeColor UI_APPEARANCE_SELECTOR;
+
 /**
  * @abstract The tab bar item associated with the button.
  */
@@ -150,6 +171,16 @@ typedef NS_ENUM(NSInteger, TBTabBarButtonLayoutOrientation) {
  */
 - (CGRect)notificationIndicatorViewFrameForBounds:(CGRect)bounds;
 
+/**
+ * @abstract Provides the frame for the badge within the button.
+ * @discussion By default, the badge is centered at the top trailing corner of the tab icon and kept within the bounds.
+ * Subclasses can override this method to customize the position of the badge.
+ * @param bounds The bounds of the button.
+ * @param badgeSize The size of the rendered badge.
+ * @return The frame for the badge.
+ */
+- (CGRect)badgeFrameForBounds:(CGRect)bounds badgeSize:(CGSize)badgeSize;
+
 /**
  * @abstract Returns the duration of the animation for showing or hiding the notification indicator.
  * @discussion Subclasses can override this method to define the duration of the animation used to show or hide the notification indicator.
@@ -30,6 +30,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface TBTabBarController (Private)
 
+/**
+ * @abstract Makes every view controller look up its `tb_tabBarController` again the next time it is asked.
+ * @discussion Call this method whenever view controllers move in or out of a tab bar controller's hierarchy.
+ */
++ (void)_invalidateCachedTabBarControllers;
+
 /**
  * @abstract Specifies the preferred tab bar placement for a given horizontal size class and view size.
  * @discussion Use this method to set the preferred tab bar placement based on specific conditions. 
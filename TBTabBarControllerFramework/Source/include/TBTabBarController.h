@@ -25,7 +25,7 @@
 #import <UIKit/UIKit.h>
 #import "TBTabBar.h"
 
-@class TBTabBarController, TBTabBarItem, TBDummyBar;
+@class TBTabBarController, TBTabBarItem, TBDummyBar, TBTabBarAppearance, TBTabBarControllerEventRecorder, TBTabBarFootprint, TBTabBarHitchMonitor, TBTabBarSelectionHistory;
 @protocol TBTabBarDelegate;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -303,6 +303,40 @@ shouldSelectViewController:(__kindof UIViewController * _Nullable)viewController
  */
 @property (assign, nonatomic) CGFloat verticalTabBarWidth;
 
+/**
+ * @abstract An object that records the events of the tab bar controller, such as item insertions and selections. The default value is `nil`.
+ * @discussion Use it to capture a workload that is hard to reproduce and replay it later with `TBTabBarControllerEventReplayer`.
+ * Nothing is recorded while this property is `nil`.
+ */
+@property (strong, nonatomic, nullable) TBTabBarControllerEventRecorder *eventRecorder;
+
+/**
+ * @abstract An object that reports the frames dropped while the tab bar controller switches tabs or moves its tab bars. The default value is `nil`.
+ * @discussion Every late frame is attributed to the phase that was running, so you can tell a slow tab transition from a slow layout of the bars.
+ * Nothing is watched while this property is `nil`.
+ */
+@property (strong, nonatomic, nullable) TBTabBarHitchMonitor *hitchMonitor;
+
+/**
+ * @abstract The time the size of the view has to stay the same before a live resize counts as settled. The default value is 0.15 seconds.
+ * @discussion Split View and Stage Manager resize the view many times while the user drags. The first size change re-evaluates
+ * the placement of the tab bars as usual, while the ones that follow it within this interval only move the bars to their new frames.
+ * The placement is re-evaluated once, when the size settles, or right away when the horizontal size class changes
+ * or `preferredTabBarPlacementForViewSize:` returns another placement. Set this property to 0 to re-evaluate the placement on every size change.
+ */
+@property (assign, nonatomic) NSTimeInterval liveResizeSettleInterval;
+
+/**
+ * @abstract Indicates whether the view is being resized continuously, so the placement of the tab bars is not re-evaluated.
+ */
+@property (assign, nonatomic, readonly, getter = isLiveResizing) BOOL liveResizing;
+
+/**
+ * @abstract The history of tab selections. It also ranks the tabs by how often they are selected.
+ * @discussion The tab bar controller records every selection and forgets the items that are removed from it.
+ */
+@property (strong, nonatomic, readonly) TBTabBarSelectionHistory *selectionHistory;
+
 @property (assign, nonatomic) CGFloat dummyBarHeight NS_UNAVAILABLE;
 
 - (instancetype)init NS_DESIGNATED_INITIALIZER;
@@ -394,6 +428,77 @@ shouldSelectViewController:(__kindof UIViewController * _Nullable)viewController
  */
 - (void)removeItemAtIndex:(NSUInteger)index NS_SWIFT_NAME(removeItem(at:));
 
+/**
+ * @abstract Moves an item to a new index in the items list. Animatable.
+ * @discussion The view controller associated with the item moves along with it, without being added to or removed from the controller again,
+ * and the selection follows the selected tab. This is what happens when the user drags a tab in a tab bar that allows item reordering.
+ * @param index The current index of the item.
+ * @param newIndex The index the item should have once moved.
+ */
+- (void)moveItemAtIndex:(NSUInteger)index toIndex:(NSUInteger)newIndex NS_SWIFT_NAME(moveItem(at:to:));
+
+/**
+ * @abstract Reorders and removes tabs to match the given identifiers, the way a diffable data source applies a snapshot.
+ * @discussion Tabs are matched by `itemIdentifier`. The tab bars move the buttons of the tabs that stay instead of recreating them,
+ * and the view controllers follow their items. When the tab bar controller has view controllers, the tabs are captured from them again,
+ * just like `removeItemAtIndex:` does. Identifiers that match no tab are ignored, so use `addItem:`, `insertItem:atIndex:`
+ * or `viewControllers` to add new tabs. When several tabs share an identifier, e.g. a tab and a copy of its item, every occurrence
+ * of the identifier takes the next of them in their current order. If the selected tab is removed, the first tab the delegate allows to select is selected.
+ * @param itemIdentifiers The identifiers of the tabs in the order they should appear.
+ */
+- (void)applyItemIdentifiers:(NSArray<NSString *> *)itemIdentifiers;
+
+/**
+ * @abstract Updates the badge values of many tab items at once.
+ * @discussion Use this method instead of setting `badgeValue` on every item when many badges change together.
+ * The visible tab bar is updated in a single pass that needs at most one layout pass, and the hidden tab bar is updated
+ * when it becomes visible. An empty string clears the badge.
+ * @param badgeValues A map from tab items to their new badge values. Create it with `+[NSMapTable strongToStrongObjectsMapTable]`,
+ * since tab items are not meant to be copied as keys.
+ */
+- (void)setBadgeValues:(NSMapTable<__kindof TBTabBarItem *, NSString *> *)badgeValues;
+
+/**
+ * @abstract Applies the appearance to both the horizontal and the vertical tab bars.
+ * @discussion The appearance is copied once, so both tab bars share the same immutable snapshot.
+ * @param appearance The appearance to apply.
+ */
+- (void)applyTabBarAppearance:(TBTabBarAppearance *)appearance NS_SWIFT_NAME(apply(_:));
+
+/**
+ * @abstract Integrates a navigation controller with the tab bar controller, so the tab bar follows its pushes and pops
+ * (see `tb_hidesTabBarWhenPushed`) and the vertical tab bar matches the height of its navigation bar.
+ * @discussion The tab bar controller registers the navigation controller of the selected tab on its own when it is either the selected
+ * view controller or its first descendant, so you only need this method for navigation controllers nested some other way.
+ * Only one navigation controller is integrated at a time, registering another one unregisters the previous one.
+ * Navigation controllers that are not registered are left untouched.
+ * @param navigationController The navigation controller to integrate.
+ */
+- (void)registerNavigationController:(UINavigationController *)navigationController;
+
+/**
+ * @abstract Stops integrating a navigation controller. A navigation controller is also unregistered when it is removed from its parent.
+ * @param navigationController The navigation controller to stop integrating.
+ */
+- (void)unregisterNavigationController:(UINavigationController *)navigationController;
+
+/**
+ * @abstract Selects the tab that was selected before the current one, as if the user tapped it.
+ * @discussion The current tab is dropped from the selection history, so calling this method repeatedly walks back through the history.
+ * The delegate can prevent the selection, in which case the history does not change.
+ * @return `YES` if the previous tab has been selected, `NO` otherwise.
+ */
+- (BOOL)selectPreviousTab;
+
+/**
+ * @abstract Estimates how much memory every tab takes. Must be called on the main thread.
+ * @discussion Every footprint counts the loaded view hierarchy of the view controller of the tab, the decoded images of its item
+ * and what its buttons display in both tab bars. Views that have not been loaded are not loaded by the measurement.
+ * Use the footprints to decide which tabs to release on a memory warning or which ones are cheap enough to prepare ahead of time.
+ * @return The footprints of the tabs, in the order of `items`.
+ */
+- (NSArray<TBTabBarFootprint *> *)footprintsOfTabs;
+
 @end
 
 #pragma mark - Subclassing
@@ -0,0 +1,191 @@
+//
+//  TBTabBarControllerEventTrace.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+@class TBTabBarController;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract The kinds of events a tab bar controller records.
+ */
+typedef NS_ENUM(uint8_t, TBTabBarControllerEventType) {
+    /// The view controllers were replaced. The first argument is the number of view controllers.
+    TBTabBarControllerEventTypeSetViewControllers = 1,
+
+    /// An item was inserted. The first argument is the index of the item.
+    TBTabBarControllerEventTypeInsertItem,
+
+    /// An item was removed. The first argument is the index of the item.
+    TBTabBarControllerEventTypeRemoveItem,
+
+    /// An item was selected, either by the user or programmatically. The first argument is the index of the item.
+    TBTabBarControllerEventTypeSelectItem,
+
+    /// A property of an item changed. The first argument is the index of the item, the second one is a `TBTabBarControllerEventItemProperty`.
+    TBTabBarControllerEventTypeChangeItem,
+
+    /// The view of the tab bar controller is transitioning to a new size. The arguments are the width and the height in points.
+    TBTabBarControllerEventTypeTransitionToSize,
+
+    /// An item was moved. The first argument is the previous index of the item, the second one is the new index.
+    TBTabBarControllerEventTypeMoveItem
+};
+
+/**
+ * @abstract The item properties recorded by `TBTabBarControllerEventTypeChangeItem` events.
+ */
+typedef NS_ENUM(uint8_t, TBTabBarControllerEventItemProperty) {
+    TBTabBarControllerEventItemPropertyImage,
+    TBTabBarControllerEventItemPropertySelectedImage,
+    TBTabBarControllerEventItemPropertyNotificationIndicator,
+    TBTabBarControllerEventItemPropertyShowsNotificationIndicator,
+    TBTabBarControllerEventItemPropertyBadgeValue,
+    TBTabBarControllerEventItemPropertyEnabled
+};
+
+/**
+ * @abstract The domain of the errors returned by `TBTabBarControllerEventReplayer`.
+ */
+FOUNDATION_EXPORT NSErrorDomain const TBTabBarControllerEventTraceErrorDomain;
+
+#pragma mark - Recorder
+
+/**
+ * @abstract An object that records the events of a tab bar controller into a compact binary trace.
+ * @discussion Assign a recorder to the `eventRecorder` property of a tab bar controller to reproduce its workload later with
+ * `TBTabBarControllerEventReplayer`. Every event takes a few bytes: its type, the time since the previous event and its arguments,
+ * all of them written as variable-length integers. Only indexes and counts are recorded, never the content of the items.
+ */
+@interface TBTabBarControllerEventRecorder : NSObject
+
+/**
+ * @abstract The number of recorded events.
+ */
+@property (assign, nonatomic, readonly) NSUInteger numberOfEvents;
+
+/**
+ * @abstract The trace of the recorded events.
+ */
+@property (copy, nonatomic, readonly) NSData *trace;
+
+/**
+ * @abstract Appends an event to the trace. The tab bar controller calls this method on its own.
+ * @param type The type of the event.
+ * @param firstArgument The first argument of the event.
+ * @param secondArgument The second argument of the event. Pass 0 if the event takes a single argument.
+ */
+- (void)recordEvent:(TBTabBarControllerEventType)type firstArgument:(NSUInteger)firstArgument secondArgument:(NSUInteger)secondArgument;
+
+/**
+ * @abstract Writes the trace to a file.
+ * @param url The file URL.
+ * @param error On return, the error that occurred, if any.
+ * @return `YES` if the trace was written, `NO` otherwise.
+ */
+- (BOOL)writeTraceToURL:(NSURL *)url error:(NSError *_Nullable *_Nullable)error;
+
+/**
+ * @abstract Drops all the recorded events.
+ */
+- (void)reset;
+
+@end
+
+#pragma mark - Replay report
+
+/**
+ * @abstract The results of a trace replay.
+ */
+@interface TBTabBarControllerEventReplayReport : NSObject
+
+/**
+ * @abstract The number of replayed events.
+ */
+@property (assign, nonatomic, readonly) NSUInteger numberOfEvents;
+
+/**
+ * @abstract The time the recorded workload originally took.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval recordedDuration;
+
+/**
+ * @abstract The time the replay took. Events are replayed back to back, ignoring the recorded timing.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval duration;
+
+/**
+ * @abstract The number of events replayed per second.
+ */
+@property (assign, nonatomic, readonly) double eventsPerSecond;
+
+/**
+ * @abstract The number of memory blocks the replay allocated and did not free before it finished.
+ * @discussion The value is taken from the statistics of all malloc zones, so other threads may affect it.
+ */
+@property (assign, nonatomic, readonly) NSInteger allocatedBlocks;
+
+/**
+ * @abstract The number of bytes the replay allocated and did not free before it finished.
+ */
+@property (assign, nonatomic, readonly) NSInteger allocatedBytes;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+#pragma mark - Replayer
+
+/**
+ * @abstract An object that drives a tab bar controller with the events of a recorded trace.
+ * @discussion The replayer creates placeholder view controllers and items, so the trace does not need the app that recorded it.
+ * Events that cannot be applied to the current state of the tab bar controller (e.g. an index out of bounds) are skipped.
+ */
+@interface TBTabBarControllerEventReplayer : NSObject
+
+/**
+ * @abstract Creates a replayer.
+ * @param trace A trace made by `TBTabBarControllerEventRecorder`.
+ * @param error On return, the error that occurred if the trace is malformed.
+ * @return A replayer, or `nil` if the trace is malformed.
+ */
+- (nullable instancetype)initWithTrace:(NSData *)trace error:(NSError *_Nullable *_Nullable)error NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @abstract Replays the trace on the given tab bar controller. Must be called on the main thread.
+ * @param tabBarController The tab bar controller to drive.
+ * @return The results of the replay.
+ */
+- (TBTabBarControllerEventReplayReport *)replayOnTabBarController:(TBTabBarController *)tabBarController;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -28,12 +28,19 @@
 #import "TBSimpleBar.h"
 #import "TBTabBar.h"
 #import "TBTabBar+Private.h"
+#import "TBTabBarAppearance.h"
 #import "TBTabBarButton.h"
+#import "TBTabBarButton+Private.h"
 #import "TBTabBarController.h"
 #import "TBTabBarController+Private.h"
+#import "TBTabBarControllerEventTrace.h"
+#import "TBTabBarFootprint.h"
+#import "TBTabBarHitchMonitor.h"
 #import "TBTabBarItem.h"
 #import "TBTabBarItemChange.h"
 #import "TBTabBarItemsDifference.h"
+#import "TBTabBarLayerButton.h"
+#import "TBTabBarSelectionHistory.h"
 
 //! Project version number for TBTabBarController.
 FOUNDATION_EXPORT double TBTabBarControllerVersionNumber;
@@ -0,0 +1,98 @@
+//
+//  TBTabBarFootprint.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+@class TBTabBarItem, TBTabBarButton;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract An estimate of the memory a tab takes, measured when the footprint is created.
+ * @discussion The footprint counts the loaded view hierarchy of the view controller of the tab, the decoded images of its item
+ * and whatever the buttons of the tab display in the tab bars. The backing store of a layer is estimated from the bitmap it displays,
+ * or from its size and scale when it draws its own content. A bitmap shared by several layers or images of the tab is counted once.
+ * The numbers are estimates meant for comparing tabs with each other, e.g. to pick the one to evict on a memory warning.
+ */
+@interface TBTabBarFootprint : NSObject
+
+/**
+ * @abstract The item of the tab.
+ */
+@property (strong, nonatomic, readonly) __kindof TBTabBarItem *item;
+
+/**
+ * @abstract The view controller of the tab, if there is one.
+ */
+@property (weak, nonatomic, readonly, nullable) __kindof UIViewController *viewController;
+
+/**
+ * @abstract Indicates whether the view of the view controller was loaded when the footprint was measured.
+ */
+@property (assign, nonatomic, readonly, getter = isViewLoaded) BOOL viewLoaded;
+
+/**
+ * @abstract The number of views in the view hierarchy of the view controller.
+ */
+@property (assign, nonatomic, readonly) NSUInteger numberOfViews;
+
+/**
+ * @abstract The number of layers in the view hierarchy of the view controller, including the layers of the views.
+ */
+@property (assign, nonatomic, readonly) NSUInteger numberOfLayers;
+
+/**
+ * @abstract The estimated size of the backing stores of the layers in the view hierarchy of the view controller, in bytes.
+ */
+@property (assign, nonatomic, readonly) NSUInteger viewHierarchyBytes;
+
+/**
+ * @abstract The decoded size of the images held by the item and by the buttons of the tab in both tab bars, in bytes.
+ * @discussion Bitmaps that the view hierarchy of the view controller displays as well are counted in `viewHierarchyBytes` only.
+ */
+@property (assign, nonatomic, readonly) NSUInteger imageBytes;
+
+/**
+ * @abstract The sum of `viewHierarchyBytes` and `imageBytes`.
+ */
+@property (assign, nonatomic, readonly) NSUInteger totalBytes;
+
+/**
+ * @abstract Measures the footprint of a tab. Must be called on the main thread.
+ * @param item The item of the tab.
+ * @param viewController The view controller of the tab, if there is one. Its view is never loaded by the measurement.
+ * @param buttons The buttons that display the item in the tab bars.
+ * @return The footprint of the tab.
+ */
+- (instancetype)initWithItem:(__kindof TBTabBarItem *)item
+              viewController:(nullable __kindof UIViewController *)viewController
+                     buttons:(NSArray<__kindof TBTabBarButton *> *)buttons NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
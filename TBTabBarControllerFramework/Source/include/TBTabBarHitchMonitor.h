@@ -0,0 +1,173 @@
+//
+//  TBTabBarHitchMonitor.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class TBTabBarHitchMonitor;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract The phases of a tab bar controller a hitch monitor tells apart, from the outermost to the innermost.
+ */
+typedef NS_ENUM(NSUInteger, TBTabBarHitchPhase) {
+    /// Switching between the view controllers of two tabs, from the start of the transition until it completes.
+    TBTabBarHitchPhaseTabTransition,
+
+    /// Moving the tab bars to a new placement, from `beginTabBarTransition` until `endTabBarTransition`.
+    TBTabBarHitchPhaseTabBarTransition,
+
+    /// Laying out the tab bars. Only watched while one of the transitions is in flight.
+    TBTabBarHitchPhaseBarLayout
+};
+
+#pragma mark - Hitch
+
+/**
+ * @abstract A frame that was displayed later than expected.
+ */
+@interface TBTabBarHitch : NSObject
+
+/**
+ * @abstract The phase the hitch is attributed to, i.e. the innermost phase that was running during the frame.
+ */
+@property (assign, nonatomic, readonly) TBTabBarHitchPhase phase;
+
+/**
+ * @abstract The time the frame was displayed at, in the `CACurrentMediaTime()` timebase.
+ */
+@property (assign, nonatomic, readonly) CFTimeInterval timestamp;
+
+/**
+ * @abstract The time between the previous frame and this one.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval frameDuration;
+
+/**
+ * @abstract The time a frame should take at the current refresh rate.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval expectedFrameDuration;
+
+/**
+ * @abstract The time the frame was late by.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval hitchDuration;
+
+/**
+ * @abstract Returns the time the given phase was running during the frame.
+ * @param phase The phase.
+ * @return The time the phase was running during the frame.
+ */
+- (NSTimeInterval)durationOfPhase:(TBTabBarHitchPhase)phase;
+
+- (instancetype)init NS_UNAVAILABLE;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+#pragma mark - Delegate
+
+/**
+ * @abstract The `TBTabBarHitchMonitorDelegate` protocol defines the method a hitch monitor reports hitches through.
+ */
+@protocol TBTabBarHitchMonitorDelegate <NSObject>
+
+@optional
+
+/**
+ * @abstract Notifies the delegate that a frame was late. Called on the main thread right after the late frame.
+ * @param hitchMonitor The hitch monitor that detected the hitch.
+ * @param hitch The hitch.
+ */
+- (void)hitchMonitor:(TBTabBarHitchMonitor *)hitchMonitor didDetectHitch:(TBTabBarHitch *)hitch;
+
+@end
+
+#pragma mark - Monitor
+
+/**
+ * @abstract An object that watches the frames displayed while a tab bar controller switches tabs or moves its tab bars,
+ * and attributes the late ones to the phase that was running.
+ * @discussion Assign a monitor to the `hitchMonitor` property of a tab bar controller. A display link runs only while
+ * a tab transition or a tab bar transition is in flight, and stops on the first frame after the last one ends,
+ * so the frame that finishes the work is measured too. A frame is late when it takes longer than the expected frame duration
+ * plus the tolerance. Must be used on the main thread.
+ */
+@interface TBTabBarHitchMonitor : NSObject
+
+/**
+ * @abstract The delegate that receives the hitches.
+ */
+@property (weak, nonatomic, nullable) id <TBTabBarHitchMonitorDelegate> delegate;
+
+/**
+ * @abstract How much longer than expected a frame may take before it counts as a hitch, as a fraction of the expected frame duration.
+ * The default value is 0.5.
+ */
+@property (assign, nonatomic) double tolerance;
+
+/**
+ * @abstract The number of detected hitches.
+ */
+@property (assign, nonatomic, readonly) NSUInteger numberOfHitches;
+
+/**
+ * @abstract The total time the detected hitches were late by.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval totalHitchDuration;
+
+/**
+ * @abstract Indicates whether the monitor is watching frames at the moment.
+ */
+@property (assign, nonatomic, readonly, getter = isMonitoring) BOOL monitoring;
+
+/**
+ * @abstract Returns the total time the given phase has been running while the monitor was watching.
+ * @param phase The phase.
+ * @return The total time the phase has been running.
+ */
+- (NSTimeInterval)durationOfPhase:(TBTabBarHitchPhase)phase;
+
+/**
+ * @abstract Marks the beginning of a phase. The tab bar controller calls this method on its own.
+ * @discussion Phases can nest, a phase ends when every `beginPhase:` call is balanced by an `endPhase:` call.
+ * @param phase The phase that begins.
+ */
+- (void)beginPhase:(TBTabBarHitchPhase)phase;
+
+/**
+ * @abstract Marks the end of a phase. The tab bar controller calls this method on its own.
+ * @param phase The phase that ends.
+ */
+- (void)endPhase:(TBTabBarHitchPhase)phase;
+
+/**
+ * @abstract Drops the hitch count and the phase durations collected so far.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
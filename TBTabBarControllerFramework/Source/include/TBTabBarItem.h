@@ -32,9 +32,26 @@ NS_ASSUME_NONNULL_BEGIN
  * @abstract An item in a tab bar, similar to UITabBarItem.
  * @discussion The `TBTabBarItem` class represents an item within a tab bar. It provides information and customization 
  * options for a specific tab, including its title, icon, and notification indicator.
+ *
+ * The properties, except for `itemIdentifier`, can be set from any thread. A value set off the main thread is applied on the main thread on its next
+ * run loop turn, and only the last of the values set to a property until then is applied, so observers and tab bars see it once.
+ * Until then, getters return the previous value. A value set on the main thread takes effect right away and wins over
+ * the values set to the same property off the main thread before it. Observers are always notified on the main thread.
+ *
+ * Only the writes are thread-safe: read the properties, copy and compare items on the main thread, where the values
+ * are stored, as a read on another thread may race with a write and get a released object.
  */
 @interface TBTabBarItem : NSObject <NSCopying>
 
+/**
+ * @abstract A string that identifies the tab. By default, every item gets a unique identifier, and copies of an item share it.
+ * @discussion Tab bars compare items by their identifiers when the items change, so an item replaced with another one
+ * with the same identifier keeps its button and only updates its contents. Several tabs may share an identifier, e.g. a tab
+ * and a copy of its item, but then the tab bars compare their items as a whole and may recreate buttons, so reset the identifier
+ * of a copy that is meant to become another tab. Set this property on the main thread only.
+ */
+@property (copy, nonatomic, null_resettable) NSString *itemIdentifier;
+
 /**
  * @abstract Indicates whether the item should be enabled or disabled. The default value is YES.
  */
@@ -52,19 +69,31 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  * @abstract The tab's icon image.
+ * @discussion Images with the same pixels and drawing attributes are shared between items, so the getter may return another
+ * instance with the same content than the one that was set. The pixels are compared in the background, so the shared instance
+ * replaces the one that was set shortly after, and observers are notified of it. Images from an asset catalog, symbol images
+ * and images with an accessibility label or identifier are always kept as they are.
  */
 @property (strong, nonatomic) UIImage *image;
 
 /**
- * @abstract The tab's icon image when it is selected.
+ * @abstract The tab's icon image when it is selected. Shared between items the same way as `image`.
  */
 @property (strong, nonatomic, nullable) UIImage *selectedImage;
 
 /**
  * @abstract The image for the notification indicator that appears next to the tab icon. The default is a small dot.
+ * Shared between items the same way as `image`.
  */
 @property (strong, nonatomic, null_resettable) UIImage *notificationIndicator;
 
+/**
+ * @abstract The text displayed in a badge at the top trailing corner of the tab icon, for example, "3" or "99+". The default value is nil.
+ * @discussion Set this property to nil or to an empty string to hide the badge. Badges are rendered from cached glyphs,
+ * so it is cheap to update this property frequently.
+ */
+@property (copy, nonatomic, nullable) NSString *badgeValue;
+
 /**
  * @abstract The class of the button that will be displayed in the tab bar. The default class is `TBTabBarButton`.
  */
@@ -32,7 +32,8 @@ NS_ASSUME_NONNULL_BEGIN
  * @abstract Represents the difference between two arrays of TBTabBarItem instances.
  * @discussion The `TBTabBarItemsDifference` class encapsulates the changes between two arrays of tab items.
  * Starting from iOS 13 and newer, it uses `NSOrderedCollectionDifference` to calculate the difference,
- * while older versions calculate the difference manually
+ * while older versions calculate the minimal set of changes with the Myers algorithm. In both cases removals come first,
+ * from the highest index to the lowest, followed by insertions from the lowest index to the highest.
  */
 @interface TBTabBarItemsDifference : NSObject <NSFastEnumeration> {
 
@@ -78,6 +79,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)differenceWithItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other;
 
+/**
+ * @abstract Creates a TBTabBarItemsDifference instance by comparing the identifiers of the items rather than the items themselves.
+ * @discussion Items with the same `itemIdentifier` are the same tab, even if they are different objects or their properties differ,
+ * so such items never appear in the difference. The items that keep their relative order are left in place and the rest are
+ * moved, which is expressed as a removal followed by an insertion. Takes O(n log n) time. If either array has several items
+ * with the same identifier, e.g. an item and its copy, the items are compared as a whole, as `differenceWithItems:from:` does.
+ * @param array An array of TBTabBarItem objects.
+ * @param other Another array of TBTabBarItem objects to compare with.
+ * @return A TBTabBarItemsDifference instance representing the differences between the two arrays.
+ */
++ (instancetype)differenceByIdentifyingItems:(NSArray<TBTabBarItem *> *)array from:(NSArray<TBTabBarItem *> *)other;
+
 /**
  * @abstract This method is unavailable. Use designated initializers to create TBTabBarItemsDifference instances.
  */
@@ -0,0 +1,57 @@
+//
+//  TBTabBarLayerButton.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <UIKit/UIKit.h>
+#import "TBTabBarButton.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A lightweight tab bar button that displays its content without subviews.
+ * @discussion `TBTabBarLayerButton` renders the tab icon and the notification indicator as contents of two sublayers
+ * of its own layer, so every tab costs one view and at most three layers. Template and symbol images are tinted once
+ * and cached per tint color, which makes selection changes cheap. The owning `TBTabBar` hit-tests these buttons
+ * directly by their frames.
+ *
+ * Since there are no subviews, the `imageView` and `notificationIndicatorView` properties are not used to display anything.
+ * Setting a custom `notificationIndicatorView` has no effect; use the `notificationIndicator` property of the tab bar item instead.
+ * You can still override `imageViewFrameForBounds:` and `notificationIndicatorViewFrameForBounds:` to position the layers.
+ *
+ * To use this button, set the `buttonClass` property of a tab bar item to `TBTabBarLayerButton.class`.
+ */
+@interface TBTabBarLayerButton : TBTabBarButton
+
+/**
+ * @abstract A layer displaying the tab icon.
+ */
+@property (strong, nonatomic, readonly) CALayer *iconLayer;
+
+/**
+ * @abstract A layer displaying the notification indicator.
+ */
+@property (strong, nonatomic, readonly) CALayer *notificationIndicatorLayer;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,122 @@
+//
+//  TBTabBarSelectionHistory.h
+//  TBTabBarController
+//
+//  Copyright © 2019-2023 Timur Ganiev. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class TBTabBarItem;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @abstract A bounded history of tab selections along with the usage of every tab.
+ * @discussion The history keeps the most recent selections in a ring buffer, so recording a selection and going back take constant time.
+ * When the history is full, the oldest selection is dropped. Selecting the same item twice in a row is recorded once.
+ *
+ * Every selection also adds to the usage of the item. Older selections weigh less than recent ones: each new selection makes
+ * the previous ones count `usageDecay` times less. The items are kept ordered by their usage, so `mostUsedItems` does not sort anything.
+ *
+ * Items are compared by identity, so two items with the same image are tracked separately.
+ */
+@interface TBTabBarSelectionHistory : NSObject
+
+/**
+ * @abstract The maximum number of selections the history keeps.
+ */
+@property (assign, nonatomic, readonly) NSUInteger capacity;
+
+/**
+ * @abstract The factor every recorded usage is multiplied by when a new selection is recorded. Between 0.0 and 1.0, the default value is 0.9.
+ */
+@property (assign, nonatomic, readonly) double usageDecay;
+
+/**
+ * @abstract The number of selections in the history.
+ */
+@property (assign, nonatomic, readonly) NSUInteger count;
+
+/**
+ * @abstract The most recently selected item.
+ */
+@property (strong, nonatomic, readonly, nullable) TBTabBarItem *currentItem;
+
+/**
+ * @abstract The item selected before the current one.
+ */
+@property (strong, nonatomic, readonly, nullable) TBTabBarItem *previousItem;
+
+/**
+ * @abstract The items ever selected, ordered from the most used to the least used.
+ */
+@property (copy, nonatomic, readonly) NSArray<TBTabBarItem *> *mostUsedItems;
+
+/**
+ * @abstract Creates a history.
+ * @param capacity The maximum number of selections to keep. Must be greater than 0.
+ * @param usageDecay The factor older selections weigh less by. Must be greater than 0.0 and not greater than 1.0, where 1.0 disables the decay.
+ * @return A selection history.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity usageDecay:(double)usageDecay NS_DESIGNATED_INITIALIZER;
+
+/**
+ * @abstract Creates a history that keeps 32 selections and uses the default decay.
+ */
+- (instancetype)init;
+
+/**
+ * @abstract Records the selection of an item.
+ * @param item The selected item.
+ */
+- (void)pushItem:(TBTabBarItem *)item;
+
+/**
+ * @abstract Drops the current item and returns the item selected before it, which becomes the current one.
+ * @discussion The usage of the items does not change.
+ * @return The previous item, or `nil` if there is none. In the latter case the history does not change.
+ */
+- (nullable TBTabBarItem *)popItem;
+
+/**
+ * @abstract Forgets an item, for example when it is removed from the tab bar.
+ * @discussion All the selections of the item are dropped from the history and its usage is reset. If this leaves two selections
+ * of another item next to each other, they are merged into one.
+ * @param item The item to forget.
+ */
+- (void)removeItem:(TBTabBarItem *)item;
+
+/**
+ * @abstract Returns the usage of an item, or 0.0 if the item has never been selected.
+ * @discussion The value is only meaningful compared to the usage of the other items.
+ * @param item The item.
+ * @return The usage of the item.
+ */
+- (double)usageOfItem:(TBTabBarItem *)item;
+
+/**
+ * @abstract Drops all the selections and the usage of all the items.
+ */
+- (void)removeAllItems;
+
+@end
+
+NS_ASSUME_NONNULL_END